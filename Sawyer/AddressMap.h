@@ -26,6 +26,9 @@
 namespace Sawyer {
 namespace Container {
 
+template<class A, class T = boost::uint8_t>
+class FrozenAddressMap;
+
 template<class AddressMap>
 struct AddressMapTraits {
     typedef typename AddressMap::NodeIterator NodeIterator;
@@ -1045,6 +1048,37 @@ public:
         }
     }
 
+    /** Assignment.
+     *
+     *  This map is made to have the same addresses mapped to the same buffers as the @p other map. */
+    AddressMap& operator=(const AddressMap &other) {
+        Super::operator=(other);
+        return *this;
+    }
+
+    /** Move constructor.
+     *
+     *  Takes the segments from the @p other map, which is left empty. */
+    AddressMap(AddressMap &&other)
+        : Super(std::move(other)) {}
+
+    /** Move assignment.
+     *
+     *  Takes the segments from the @p other map, which is left empty. */
+    AddressMap& operator=(AddressMap &&other) {
+        Super::operator=(std::move(other));
+        return *this;
+    }
+
+    /** Immutable copy of this map.
+     *
+     *  Returns a map that has the same addresses mapped to the same buffers as this map, but which cannot be modified and
+     *  which stores its segments in arrays that are faster to search than this map's tree. This is useful when a map is
+     *  built once and then only read, such as the map for a loaded binary specimen. See @ref FrozenAddressMap. */
+    FrozenAddressMap<A, T> freeze() const {
+        return FrozenAddressMap<A, T>(*this);
+    }
+
     /** Constraint: required access bits.
      *
      *  Constrains address to those that have all of the access bits that are set in @p x.
@@ -1763,6 +1797,7 @@ public:
                         if (iter->value().buffer() == buffer)
                             iter->value().buffer(newBuffer);
                     }
+                    this->markModified();
                     buffer = newBuffer;
                 }
 
@@ -1872,6 +1907,7 @@ public:
                 Sawyer::Container::Interval<Address> toChange = node.key() & m.interval_;
                 if (toChange == node.key()) {           // all addresses in segment are selected; change segment in place
                     segment.accessibility(newAccess);
+                    this->markModified();
                 } else {                                // insert a new segment, replacing part of the existing one
                     Segment newSegment(segment);
                     newSegment.accessibility(newAccess);
@@ -1898,4 +1934,7 @@ private:
 } // namespace
 } // namespace
 
+// FrozenAddressMap::freeze needs the complete type
+#include <Sawyer/FrozenAddressMap.h>
+
 #endif
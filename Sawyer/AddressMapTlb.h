@@ -0,0 +1,284 @@
+#ifndef Sawyer_AddressMapTlb_H
+#define Sawyer_AddressMapTlb_H
+
+#include <Sawyer/Access.h>
+#include <Sawyer/AddressMap.h>
+#include <Sawyer/Assert.h>
+#include <Sawyer/Optional.h>
+#include <Sawyer/Sawyer.h>
+
+#include <boost/cstdint.hpp>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+
+/** Translation cache for small reads and writes of an address map.
+ *
+ *  Reading a few values through an @ref AddressMap, as in <code>map.at(va).limit(4).read(buf)</code>, builds a constraints
+ *  object, searches the map's tree of segments, checks the segment's access bits, and then reads from the segment's buffer
+ *  through a virtual function. Emulators and instruction decoders do this for nearly every instruction. This object is a
+ *  software TLB for such accesses: it divides the address space into pages and caches, for each recently used page, the part
+ *  of the page that's served by a single segment along with that segment's access bits and a pointer to the buffer data.
+ *  When a translation is cached, a read is an array lookup, an address comparison, and a @c memcpy.
+ *
+ *  The cache is direct mapped: each page has one slot determined by a hash of its page number, and a page evicts whichever
+ *  other page was using that slot. Hashing keeps regularly spaced pages, such as every other page, from competing for a few
+ *  slots. The number of slots and the page size are powers of two chosen when the cache is constructed.
+ *
+ *  The cache checks the map's @ref IntervalMap::generation "generation" number on each access and discards all translations
+ *  when the map has been modified. Changes that the map cannot detect, such as modifying a segment in place through a mutable
+ *  iterator or resizing a buffer, must be followed by a call to the map's @ref IntervalMap::markModified "markModified" or
+ *  to this object's @ref flush method.
+ *
+ *  The map must outlive this object. The cache is not thread safe, even for reading, since reading updates the cache; each
+ *  thread should have its own. The template argument is the map type, which may be const-qualified if only reads are
+ *  needed.
+ *
+ *  @code
+ *  typedef AddressMap<uint64_t, uint8_t> MemoryMap;
+ *  MemoryMap map = ...;
+ *  AddressMapTlb<MemoryMap> tlb(map);
+ *  if (Optional<uint32_t> word = tlb.read32(va, Access::READABLE))
+ *      ...
+ *  @endcode */
+template<class AddressMap>
+class AddressMapTlb {
+public:
+    typedef typename std::remove_const<AddressMap>::type Map; /**< Type of map without const qualifier. */
+    typedef typename Map::Address Address;              /**< Type for addresses. */
+    typedef typename Map::Value Value;                  /**< Type of values stored in the map. */
+    typedef typename Map::Buffer Buffer;                /**< Type of buffers referenced by the map's segments. */
+
+private:
+    // A translation for the part of one page that's served by one segment.
+    struct Entry {
+        Address least;                                  // first address translated by this entry
+        Address greatest;                               // last address, or less than least if the entry is empty
+        const Value *data;                              // value at least, or null if the buffer has no data pointer
+        Buffer *buffer;                                 // buffer containing the value at least...
+        Address offset;                                 // ...at this offset
+        unsigned access;                                // accessibility bits of the segment
+
+        Entry()
+            : least(1), greatest(0), data(NULL), buffer(NULL), offset(0), access(0) {}
+    };
+
+    AddressMap *map_;
+    size_t generation_;                                 // map generation for which the entries are valid
+    size_t pageShift_;                                  // log2 of the page size
+    Address pageMask_;                                  // page size minus one
+    size_t slotShift_;                                  // 64 minus log2 of the number of entries
+    std::vector<Entry> entries_;
+    size_t nHits_, nMisses_;
+
+public:
+    /** Construct a cache for a map.
+     *
+     *  The @p nEntries is the number of pages whose translations can be cached at once, and @p pageSize is the number of
+     *  addresses per page. Both must be powers of two. */
+    explicit AddressMapTlb(AddressMap &map, size_t nEntries = 256, size_t pageSize = 4096)
+        : map_(&map), generation_(map.generation()), pageShift_(0), pageMask_(pageSize - 1), slotShift_(64),
+          entries_(nEntries), nHits_(0), nMisses_(0) {
+        ASSERT_require2(nEntries > 0 && (nEntries & (nEntries - 1)) == 0, "number of entries must be a power of two");
+        ASSERT_require2(pageSize > 0 && (pageSize & (pageSize - 1)) == 0, "page size must be a power of two");
+        while ((size_t(1) << pageShift_) < pageSize)
+            ++pageShift_;
+        for (size_t n = nEntries; n > 1; n /= 2)
+            --slotShift_;
+    }
+
+    /** Map whose addresses are translated. */
+    AddressMap& map() const {
+        return *map_;
+    }
+
+    /** Discard all cached translations. */
+    void flush() {
+        for (Entry &entry: entries_)
+            entry = Entry();
+        generation_ = map_->generation();
+    }
+
+    /** Number of accesses that found a cached translation. */
+    size_t nHits() const {
+        return nHits_;
+    }
+
+    /** Number of accesses that had to search the map. */
+    size_t nMisses() const {
+        return nMisses_;
+    }
+
+    /** Read values.
+     *
+     *  Reads up to @p n values starting at address @p va into @p buf and returns the number of values read. Reading stops at
+     *  the first address that's not mapped, or whose segment lacks any of the @p requiredAccess bits. The result is the same
+     *  as <code>map.at(va).limit(n).require(requiredAccess).read(buf).size()</code>. */
+    size_t read(Value *buf, Address va, size_t n, unsigned requiredAccess = 0) {
+        size_t nRead = 0;
+        while (nRead < n) {
+            const Entry *entry = translate(va);
+            if (!entry || (entry->access & requiredAccess) != requiredAccess)
+                break;
+            size_t nValues = std::min(n - nRead, size_t(entry->greatest - va) + 1);
+            if (entry->data) {
+                memcpy(buf + nRead, entry->data + (va - entry->least), nValues * sizeof(Value));
+            } else {
+                entry->buffer->read(buf + nRead, entry->offset + (va - entry->least), nValues);
+            }
+            nRead += nValues;
+            va += nValues;
+            if (va == 0)
+                break;                                  // address overflow
+        }
+        return nRead;
+    }
+
+    /** Write values.
+     *
+     *  Writes up to @p n values from @p buf starting at address @p va and returns the number of values written. Writing stops
+     *  at the first address that's not mapped, or whose segment lacks any of the @p requiredAccess bits or has the
+     *  Access::IMMUTABLE bit. The result is the same as
+     *  <code>map.at(va).limit(n).require(requiredAccess).write(buf).size()</code>, including the handling of copy-on-write
+     *  buffers. */
+    size_t write(const Value *buf, Address va, size_t n, unsigned requiredAccess = 0) {
+        size_t nWritten = 0;
+        while (nWritten < n) {
+            const Entry *entry = translate(va);
+            if (!entry || (entry->access & requiredAccess) != requiredAccess || (entry->access & Access::IMMUTABLE) != 0)
+                break;
+            size_t nValues = std::min(n - nWritten, size_t(entry->greatest - va) + 1);
+            if (entry->buffer->copyOnWrite()) {
+                // The map replaces the buffer, which invalidates this cache.
+                nWritten += map_->at(va).limit(n - nWritten).require(requiredAccess).write(buf + nWritten).size();
+                break;
+            }
+            if (entry->buffer->write(buf + nWritten, entry->offset + (va - entry->least), nValues) != nValues)
+                ASSERT_not_reachable("something is wrong with the memory map");
+            nWritten += nValues;
+            va += nValues;
+            if (va == 0)
+                break;                                  // address overflow
+        }
+        return nWritten;
+    }
+
+    /** Read an integer.
+     *
+     *  Reads the bytes of an integer in host byte order, returning nothing if any of the bytes cannot be read. These methods
+     *  are only available for maps whose values are bytes.
+     *
+     * @{ */
+    Optional<boost::uint8_t> read8(Address va, unsigned requiredAccess = 0) {
+        return readInteger<boost::uint8_t>(va, requiredAccess);
+    }
+    Optional<boost::uint16_t> read16(Address va, unsigned requiredAccess = 0) {
+        return readInteger<boost::uint16_t>(va, requiredAccess);
+    }
+    Optional<boost::uint32_t> read32(Address va, unsigned requiredAccess = 0) {
+        return readInteger<boost::uint32_t>(va, requiredAccess);
+    }
+    Optional<boost::uint64_t> read64(Address va, unsigned requiredAccess = 0) {
+        return readInteger<boost::uint64_t>(va, requiredAccess);
+    }
+    /** @} */
+
+    /** Write an integer.
+     *
+     *  Writes the bytes of an integer in host byte order and returns true, or returns false if any of the bytes could not be
+     *  written. These methods are only available for maps whose values are bytes.
+     *
+     * @{ */
+    bool write8(Address va, boost::uint8_t value, unsigned requiredAccess = 0) {
+        return writeInteger(va, value, requiredAccess);
+    }
+    bool write16(Address va, boost::uint16_t value, unsigned requiredAccess = 0) {
+        return writeInteger(va, value, requiredAccess);
+    }
+    bool write32(Address va, boost::uint32_t value, unsigned requiredAccess = 0) {
+        return writeInteger(va, value, requiredAccess);
+    }
+    bool write64(Address va, boost::uint64_t value, unsigned requiredAccess = 0) {
+        return writeInteger(va, value, requiredAccess);
+    }
+    /** @} */
+
+private:
+    // The entry that translates va, or null if va is not mapped.
+    const Entry* translate(Address va) {
+        if (map_->generation() != generation_)
+            flush();
+        Entry &entry = entries_[slot(va)];
+        if (va >= entry.least && va <= entry.greatest) {
+            ++nHits_;
+            return &entry;
+        }
+        ++nMisses_;
+        return fill(entry, va) ? &entry : NULL;
+    }
+
+    // Slot for the page containing va, by Fibonacci hashing of the page number.
+    size_t slot(Address va) const {
+        return slotShift_ >= 64 ? 0 : size_t((boost::uint64_t(va >> pageShift_) * 0x9e3779b97f4a7c15ull) >> slotShift_);
+    }
+
+    // Replace the entry with the translation for va. Returns false if va is not mapped.
+    bool fill(Entry &entry, Address va) {
+        entry = Entry();
+        typename Map::ConstNodeIterator found = static_cast<const Map*>(map_)->find(va);
+        if (found == static_cast<const Map*>(map_)->nodes().end())
+            return false;
+        const Buffer *buffer = found->value().buffer().getRawPointer();
+        if (!buffer)
+            return false;
+        const Address pageLeast = va & ~pageMask_;
+        const Address least = std::max(found->key().least(), pageLeast);
+        const Address offset = found->value().offset() + (least - found->key().least());
+        Address greatest = std::min(found->key().greatest(), pageLeast | pageMask_);
+        const Address available = buffer->available(offset);
+        if (available == 0)
+            return false;
+        if (available - 1 < greatest - least)
+            greatest = least + (available - 1);         // buffer is shorter than the segment
+
+        entry.least = least;
+        entry.greatest = greatest;
+        entry.data = buffer->data() ? buffer->data() + offset : NULL;
+        entry.buffer = const_cast<Buffer*>(buffer);
+        entry.offset = offset;
+        entry.access = found->value().accessibility();
+        return va <= greatest;
+    }
+
+    template<class Integer>
+    Optional<Integer> readInteger(Address va, unsigned requiredAccess) {
+        static_assert(sizeof(Value) == 1, "integer reads require a map of bytes");
+        const Entry *entry = translate(va);
+        if (entry && (entry->access & requiredAccess) == requiredAccess && entry->data &&
+            entry->greatest - va >= sizeof(Integer) - 1) {
+            Integer value;
+            memcpy(&value, entry->data + (va - entry->least), sizeof value);
+            return value;
+        }
+
+        // Slow path: the integer spans translations, or the buffer has no data pointer, or the access is denied.
+        Integer value = 0;
+        if (read(reinterpret_cast<Value*>(&value), va, sizeof value, requiredAccess) != sizeof value)
+            return Nothing();
+        return value;
+    }
+
+    template<class Integer>
+    bool writeInteger(Address va, Integer value, unsigned requiredAccess) {
+        static_assert(sizeof(Value) == 1, "integer writes require a map of bytes");
+        return write(reinterpret_cast<const Value*>(&value), va, sizeof value, requiredAccess) == sizeof value;
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
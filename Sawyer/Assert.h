@@ -17,6 +17,32 @@
 #define SAWYER_NDEBUG
 #endif
 
+// Assertion tiers, from least to most costly. See Sawyer::Assert for details.
+#define SAWYER_ASSERT_ALWAYS 0                          // only the ASSERT_always_* macros
+#define SAWYER_ASSERT_NORMAL 1                          // also the plain ASSERT_* macros
+#define SAWYER_ASSERT_HOT 2                             // also the ASSERT_hot_* macros in inner loops
+#define SAWYER_ASSERT_EXPENSIVE 3                       // also the ASSERT_expensive_* macros
+
+// The global assertion level. If not defined by the user, then it depends on SAWYER_NDEBUG for backward compatibility.
+#ifndef SAWYER_ASSERT_LEVEL
+    #ifdef SAWYER_NDEBUG
+        #define SAWYER_ASSERT_LEVEL SAWYER_ASSERT_ALWAYS
+    #else
+        #define SAWYER_ASSERT_LEVEL SAWYER_ASSERT_EXPENSIVE
+    #endif
+#endif
+
+// Per-facility assertion levels for the library's own tagged assertions. Each defaults to the global level.
+#ifndef SAWYER_ASSERT_LEVEL_BITVECTOR
+#define SAWYER_ASSERT_LEVEL_BITVECTOR SAWYER_ASSERT_LEVEL
+#endif
+#ifndef SAWYER_ASSERT_LEVEL_INDEXEDLIST
+#define SAWYER_ASSERT_LEVEL_INDEXEDLIST SAWYER_ASSERT_LEVEL
+#endif
+#ifndef SAWYER_ASSERT_LEVEL_MAP
+#define SAWYER_ASSERT_LEVEL_MAP SAWYER_ASSERT_LEVEL
+#endif
+
 namespace Sawyer {                                      // documented elsewhere
 
 /** Run-time logic assertions.
@@ -78,6 +104,40 @@ namespace Sawyer {                                      // documented elsewhere
  *  if the assertion fails the message makes sense to the user, namely "assertion failed: name and ID vectors must be the same
  *  size".
  *
+ *  Assertions are organized into tiers so that a build can keep cheap checks while discarding those whose cost is
+ *  multiplied by sitting in an inner loop. From least to most costly, the tiers are:
+ *
+ *  @li @c SAWYER_ASSERT_ALWAYS: the "always" macros, which are never disabled.
+ *  @li @c SAWYER_ASSERT_NORMAL: the plain macros like @c ASSERT_require, for invariants checked once per operation.
+ *  @li @c SAWYER_ASSERT_HOT: the @c ASSERT_hot_ macros, for cheap checks executed once per element or per word in the
+ *      innermost loops of the containers.
+ *  @li @c SAWYER_ASSERT_EXPENSIVE: the @c ASSERT_expensive_ macros, for checks that change the asymptotic cost of an
+ *      operation, such as walking a whole container.
+ *
+ *  The @c SAWYER_ASSERT_LEVEL symbol selects the highest enabled tier. If it isn't defined, then it's @c
+ *  SAWYER_ASSERT_ALWAYS when @c SAWYER_NDEBUG is defined and @c SAWYER_ASSERT_EXPENSIVE otherwise, which is how the
+ *  assertions behaved before tiers existed. A production build that wants invariant checks but not per-element checks would
+ *  compile with <code>-DSAWYER_ASSERT_LEVEL=1</code>.
+ *
+ *  The hot and expensive macros take a facility name as their first argument, and the level for that facility is the value
+ *  of the symbol @c SAWYER_ASSERT_LEVEL_ followed by the facility name. The library tags its own loops with the facilities
+ *  @c BITVECTOR, @c INDEXEDLIST, and @c MAP, each of which defaults to the global level. Users can define their own
+ *  facilities the same way:
+ *
+ * @code
+ *  #ifndef SAWYER_ASSERT_LEVEL_PARSER
+ *  #define SAWYER_ASSERT_LEVEL_PARSER SAWYER_ASSERT_LEVEL
+ *  #endif
+ *
+ *  for (size_t i = 0; i < tokens.size(); ++i) {
+ *      ASSERT_hot_require2(PARSER, tokens[i].end() >= tokens[i].begin(), "tokens must not be inverted");
+ *      ...
+ *  }
+ * @endcode
+ *
+ *  Since most of the library is templates, the levels in effect are those of the translation unit that instantiates them.
+ *  All translation units of a program should use the same levels.
+ *
  *  Failed assertions output to Sawyer::Message::assertionStream, which defaults to
  *  <code>Sawyer::Message::mlog[FATAL]</code>. This variable is initialized at the first call to @ref fail if it is a null
  *  pointer. Users can assign a different stream to it any time before then:
@@ -152,10 +212,10 @@ SAWYER_EXPORT extern AssertFailureHandler assertFailureHandler;
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// The non-"always" macros might change behavior based on whether SAWYER_NDEBUG is defined.
+// The non-"always" macros are enabled when SAWYER_ASSERT_LEVEL is at least SAWYER_ASSERT_NORMAL.
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#if defined(SAWYER_NDEBUG) && !defined(__clang_analyzer__)
+#if SAWYER_ASSERT_LEVEL < SAWYER_ASSERT_NORMAL && !defined(__clang_analyzer__)
 
 #define ASSERT_require(expr)            /*void*/
 #define ASSERT_require2(expr, note)     /*void*/
@@ -181,6 +241,35 @@ SAWYER_EXPORT extern AssertFailureHandler assertFailureHandler;
 
 #endif
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The hot-path and expensive macros are enabled according to the level of the facility named by their first argument. The
+// condition is a constant, so a disabled assertion costs nothing and its arguments are not evaluated, but they must still
+// compile.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define ASSERT_enabled(facility, tier) (SAWYER_ASSERT_LEVEL_##facility >= SAWYER_ASSERT_##tier)
+
+#define ASSERT_tier_require2(facility, tier, expr, note)                                                                       \
+    (ASSERT_enabled(facility, tier) ? ASSERT_always_require2(expr, note) : static_cast<void>(0))
+#define ASSERT_tier_forbid2(facility, tier, expr, note)                                                                        \
+    (ASSERT_enabled(facility, tier) ? ASSERT_always_forbid2(expr, note) : static_cast<void>(0))
+#define ASSERT_tier_not_null2(facility, tier, expr, note)                                                                      \
+    (ASSERT_enabled(facility, tier) ? ASSERT_always_not_null2(expr, note) : static_cast<void>(0))
+
+#define ASSERT_hot_require(facility, expr)              ASSERT_tier_require2(facility, HOT, expr, "")
+#define ASSERT_hot_require2(facility, expr, note)       ASSERT_tier_require2(facility, HOT, expr, note)
+#define ASSERT_hot_forbid(facility, expr)               ASSERT_tier_forbid2(facility, HOT, expr, "")
+#define ASSERT_hot_forbid2(facility, expr, note)        ASSERT_tier_forbid2(facility, HOT, expr, note)
+#define ASSERT_hot_not_null(facility, expr)             ASSERT_tier_not_null2(facility, HOT, expr, "")
+#define ASSERT_hot_not_null2(facility, expr, note)      ASSERT_tier_not_null2(facility, HOT, expr, note)
+
+#define ASSERT_expensive_require(facility, expr)        ASSERT_tier_require2(facility, EXPENSIVE, expr, "")
+#define ASSERT_expensive_require2(facility, expr, note) ASSERT_tier_require2(facility, EXPENSIVE, expr, note)
+#define ASSERT_expensive_forbid(facility, expr)         ASSERT_tier_forbid2(facility, EXPENSIVE, expr, "")
+#define ASSERT_expensive_forbid2(facility, expr, note)  ASSERT_tier_forbid2(facility, EXPENSIVE, expr, note)
+#define ASSERT_expensive_not_null(facility, expr)       ASSERT_tier_not_null2(facility, EXPENSIVE, expr, "")
+#define ASSERT_expensive_not_null2(facility, expr, note) ASSERT_tier_not_null2(facility, EXPENSIVE, expr, note)
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Macros recognized by some IDEs
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
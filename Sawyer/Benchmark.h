@@ -0,0 +1,271 @@
+#ifndef Sawyer_Benchmark_H
+#define Sawyer_Benchmark_H
+
+#include <Sawyer/CommandLine.h>
+#include <Sawyer/Optional.h>
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/Stopwatch.h>
+
+#include <boost/cstdint.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Sawyer {
+
+/** Micro-benchmark harness.
+ *
+ *  A benchmark program creates a @ref Suite, optionally lets it parse the command-line, and then runs any number of named
+ *  benchmarks. Each benchmark is a functor that performs a fixed amount of work.  The harness calls the functor a number of
+ *  times to warm up caches and then a number of additional times while measuring each call with a @ref Stopwatch and,
+ *  optionally, with hardware performance counters.  The results are summarized by their median and median absolute
+ *  deviation (MAD), which are less sensitive to outliers caused by other system activity than the mean and standard
+ *  deviation, and are emitted as text, CSV, or JSON lines so that results can be compared across commits.
+ *
+ * @code
+ *  int main(int argc, char *argv[]) {
+ *      Sawyer::initializeLibrary();
+ *      Sawyer::Benchmark::Suite suite("map");
+ *      suite.parseCommandLine(argc, argv, "benchmarks for Sawyer::Container::Map");
+ *
+ *      Sawyer::Container::Map<int, int> map;
+ *      suite.run("insert", 100000, [&map]() {
+ *          map.clear();
+ *          for (int i = 0; i < 100000; ++i)
+ *              map.insert(i, i);
+ *      });
+ *  }
+ * @endcode */
+namespace Benchmark {
+
+/** Output format for results. */
+enum OutputFormat {
+    FORMAT_TEXT,                                        /**< Human readable table. */
+    FORMAT_CSV,                                         /**< Comma-separated values with a header line. */
+    FORMAT_JSON                                         /**< One JSON object per line. */
+};
+
+/** Settings that control how benchmarks are run. */
+struct Settings {
+    size_t nWarmups;                                    /**< Number of unmeasured calls before measuring. */
+    size_t nRepetitions;                                /**< Number of measured calls. */
+    bool useCounters;                                   /**< Whether to measure hardware performance counters. */
+    OutputFormat format;                                /**< Output format. */
+    std::string filter;                                 /**< Regular expression selecting benchmarks by name. */
+    bool listOnly;                                      /**< List benchmark names instead of running them. */
+
+    Settings()
+        : nWarmups(1), nRepetitions(11), useCounters(false), format(FORMAT_TEXT), listOnly(false) {}
+};
+
+/** Hardware performance counter values.
+ *
+ *  Each value is the number of events that occurred while the counters were running. */
+struct CounterValues {
+    boost::uint64_t cycles;                             /**< CPU cycles. */
+    boost::uint64_t instructions;                       /**< Instructions retired. */
+    boost::uint64_t cacheMisses;                        /**< Last level cache misses. */
+    boost::uint64_t branchMisses;                       /**< Mispredicted branches. */
+
+    CounterValues()
+        : cycles(0), instructions(0), cacheMisses(0), branchMisses(0) {}
+};
+
+/** Hardware performance counters.
+ *
+ *  On Linux the counters are read with @c perf_event_open.  The counters are not available on other systems, or if the
+ *  kernel doesn't allow unprivileged access to them (see @c /proc/sys/kernel/perf_event_paranoid), in which case @ref open
+ *  returns false and @ref stop returns zeros. The counters measure only the thread that opened them. */
+class SAWYER_EXPORT Counters {
+    int leader_;                                        // group leader file descriptor, or -1
+    std::vector<int> fds_;                              // all open file descriptors, including the leader
+    bool triedOpen_;                                    // whether open was already attempted
+
+public:
+    /** Construct closed counters. */
+    Counters()
+        : leader_(-1), triedOpen_(false) {}
+
+    ~Counters();
+
+    /** Open the counters if possible.
+     *
+     *  Returns true if the counters are available. Only the first call attempts to open them. */
+    bool open();
+
+    /** Whether counters are available. */
+    bool isAvailable() const {
+        return leader_ >= 0;
+    }
+
+    /** Reset the counters to zero and start counting. */
+    void start();
+
+    /** Stop counting and return the counts since the last @ref start. */
+    CounterValues stop();
+
+private:
+    Counters(const Counters&);                          // not copyable
+    Counters& operator=(const Counters&);
+};
+
+/** Measurements for one benchmark. */
+class SAWYER_EXPORT Result {
+    std::string name_;
+    size_t nOperations_;
+    std::vector<double> seconds_;                       // elapsed time for each repetition
+    std::vector<CounterValues> counters_;               // counter values for each repetition, if counters were used
+
+public:
+    /** Construct an empty result. */
+    Result(const std::string &name, size_t nOperations)
+        : name_(name), nOperations_(nOperations) {}
+
+    /** Name of the benchmark. */
+    const std::string& name() const { return name_; }
+
+    /** Number of operations performed by each repetition. */
+    size_t nOperations() const { return nOperations_; }
+
+    /** Number of measured repetitions. */
+    size_t nRepetitions() const { return seconds_.size(); }
+
+    /** Elapsed time of each repetition. */
+    const std::vector<double>& seconds() const { return seconds_; }
+
+    /** Whether counter values were measured. */
+    bool hasCounters() const { return !counters_.empty(); }
+
+    /** Add a measurement. */
+    void insert(double seconds);
+    void insert(double seconds, const CounterValues&);
+
+    /** Median elapsed time per repetition. */
+    double median() const;
+
+    /** Median absolute deviation of the elapsed time per repetition. */
+    double mad() const;
+
+    /** Minimum elapsed time per repetition. */
+    double minimum() const;
+
+    /** Maximum elapsed time per repetition. */
+    double maximum() const;
+
+    /** Median time per operation in nanoseconds. */
+    double nsPerOperation() const;
+
+    /** Median counter values per operation.
+     *
+     *  Returns zeros if counters were not measured. The members are medians of each counter taken independently. */
+    void countersPerOperation(double &cycles, double &instructions, double &cacheMisses, double &branchMisses) const;
+};
+
+/** A collection of benchmarks.
+ *
+ *  Runs benchmarks, accumulates their results, and emits each result to an output stream as soon as it's available. */
+class SAWYER_EXPORT Suite {
+    std::string name_;
+    Settings settings_;
+    std::ostream *out_;
+    std::vector<Result> results_;
+    bool emittedHeader_;
+    Counters counters_;
+
+public:
+    /** Construct a suite with default settings that emits results to standard output. */
+    explicit Suite(const std::string &name);
+
+    /** Name of the suite. */
+    const std::string& name() const { return name_; }
+
+    /** Property: Settings.
+     *
+     * @{ */
+    const Settings& settings() const { return settings_; }
+    Settings& settings() { return settings_; }
+    /** @} */
+
+    /** Property: Output stream.
+     *
+     * @{ */
+    std::ostream& output() const { return *out_; }
+    void output(std::ostream &out) { out_ = &out; }
+    /** @} */
+
+    /** Command-line switches that adjust the settings. */
+    CommandLine::SwitchGroup commandLineSwitches();
+
+    /** Parse the command-line.
+     *
+     *  Parses the standard benchmark switches along with "--help" and returns the positional arguments. */
+    std::vector<std::string> parseCommandLine(int argc, char *argv[], const std::string &purpose);
+
+    /** Whether the named benchmark is selected by the filter. */
+    bool isSelected(const std::string &name) const;
+
+    /** Run a benchmark.
+     *
+     *  Calls @p functor once per warmup and once per measured repetition. The functor should perform @p nOperations
+     *  operations each time it's called, which is used to compute the time per operation.  Any setup that shouldn't be
+     *  measured should be done before calling this function or within the functor in a way that's small compared to the
+     *  measured work. Returns a copy of the result, or nothing if the benchmark was not run. */
+    template<class Functor>
+    Optional<Result> run(const std::string &name, size_t nOperations, Functor functor) {
+        if (!isSelected(name))
+            return Nothing();
+        if (settings_.listOnly) {
+            *out_ <<name_ <<"." <<name <<"\n";
+            return Nothing();
+        }
+
+        for (size_t i = 0; i < settings_.nWarmups; ++i)
+            functor();
+
+        Result result(name, nOperations);
+        if (settings_.useCounters && counters_.open()) {
+            for (size_t i = 0; i < settings_.nRepetitions; ++i) {
+                counters_.start();
+                Stopwatch stopwatch;
+                functor();
+                double elapsed = stopwatch.stop();
+                result.insert(elapsed, counters_.stop());
+            }
+        } else {
+            for (size_t i = 0; i < settings_.nRepetitions; ++i) {
+                Stopwatch stopwatch;
+                functor();
+                result.insert(stopwatch.stop());
+            }
+        }
+        insert(result);
+        return result;
+    }
+
+    /** Results for all benchmarks that have run. */
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    void insert(const Result&);
+    void emit(const Result&);
+};
+
+/** Prevent the compiler from optimizing away a value.
+ *
+ *  Benchmarks whose results are otherwise unused should pass them to this function so that the compiler cannot eliminate the
+ *  code that computes them. */
+template<class T>
+inline void
+doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &value;
+#endif
+}
+
+} // namespace
+} // namespace
+
+#endif
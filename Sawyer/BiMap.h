@@ -3,6 +3,7 @@
 
 #include <Sawyer/Map.h>
 #include <Sawyer/Sawyer.h>
+#include <Sawyer/SmallMap.h>
 #include <boost/foreach.hpp>
 
 namespace Sawyer {
@@ -14,14 +15,18 @@ namespace Container {
  *  forward or reverse direction in log time.  It does so by consistently maintaining two maps: a forward map and a reverse
  *  map.  The forward map maps values in the domain to values in the range, while the reverse map goes the other direction. The
  *  @ref forward and @ref reverse methods return const references to these maps.  The BiMap container provides methods for
- *  modifying the mapping. */
-template<class S, class T>
+ *  modifying the mapping.
+ *
+ *  The types of the two maps are template parameters and default to @ref Map. Any type having the same interface as @ref Map
+ *  can be used instead. In particular, most mappings have only a few entries, and @ref SmallBiMap uses @ref SmallMap so that
+ *  such mappings don't allocate any memory. */
+template<class S, class T, class F = Map<S, T>, class R = Map<T, S> >
 class BiMap {
 public:
     typedef S Source;                                   /**< Type of values in the domain. */
     typedef T Target;                                   /**< Type of values in the range. */
-    typedef Sawyer::Container::Map<Source, Target> Forward; /**< Type for domain-to-range map. */
-    typedef Sawyer::Container::Map<Target, Source> Reverse; /**< Type for range-to-domain map. */
+    typedef F Forward;                                  /**< Type for domain-to-range map. */
+    typedef R Reverse;                                  /**< Type for range-to-domain map. */
 private:
     Forward forward_;
     Reverse reverse_;
@@ -31,19 +36,16 @@ public:
      *  Constructs an empty mapping. */
     BiMap() {}
 
-    /** Copy constructor. */
-    BiMap(const BiMap &other);
-
     /** Construct a new map by composition of two maps.
      *
      *  Given two BiMap objects where the range type of the first is the domain type of the second, construct a new BiMap
      *  from the domain of the first to the range of the second.  The new map will contain only those domain/range pairs that
      *  map across both input maps. */
-    template<class U>
-    BiMap(const BiMap<Source, U> &a, const BiMap<U, Target> &b) {
-        BOOST_FOREACH (const typename Forward::Node &anode, a.forward_.nodes()) {
-            if (b.forward_.exists(anode.value())) {
-                const Target &target = b.forward_[anode.value()];
+    template<class U, class F1, class R1, class F2, class R2>
+    BiMap(const BiMap<Source, U, F1, R1> &a, const BiMap<U, Target, F2, R2> &b) {
+        BOOST_FOREACH (const typename F1::Node &anode, a.forward().nodes()) {
+            if (b.forward().exists(anode.value())) {
+                const Target &target = b.forward()[anode.value()];
                 forward_.insert(anode.key(), target);
                 reverse_.insert(target, anode.key());
             }
@@ -122,6 +124,13 @@ public:
     }
 };
 
+/** One-to-one mapping optimized for few entries.
+ *
+ *  This is a @ref BiMap whose forward and reverse maps are @ref SmallMap containers, which store up to @p N entries without
+ *  allocating memory. */
+template<class S, class T, size_t N = 8>
+using SmallBiMap = BiMap<S, T, SmallMap<S, T, N>, SmallMap<T, S, N> >;
+
 } // namespace
 } // namespace
 
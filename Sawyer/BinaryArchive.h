@@ -0,0 +1,952 @@
+#ifndef Sawyer_BinaryArchive_H
+#define Sawyer_BinaryArchive_H
+
+#include <Sawyer/AddressMap.h>
+#include <Sawyer/AddressSegment.h>
+#include <Sawyer/AllocatingBuffer.h>
+#include <Sawyer/BitVector.h>
+#include <Sawyer/Exception.h>
+#include <Sawyer/Graph.h>
+#include <Sawyer/Interval.h>
+#include <Sawyer/IntervalMap.h>
+#include <Sawyer/IntervalSet.h>
+#include <Sawyer/Map.h>
+#include <Sawyer/Optional.h>
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/Set.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/foreach.hpp>
+#include <boost/integer.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/type_traits/is_arithmetic.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Sawyer {
+
+/** Compact binary archives for %Sawyer containers.
+ *
+ *  This is a lightweight alternative to boost::serialization for persisting %Sawyer containers. An archive is a stream of
+ *  bytes that starts with a short header identifying the format and its version number, followed by the saved objects. All
+ *  integers are stored little-endian with fixed widths regardless of the host (@c long, <code>unsigned long</code>, and @c
+ *  size_t are always stored as 64 bits), and strings and sequences are prefixed by their lengths. Each container also stores
+ *  its own record version number so that the layout of one container can evolve without invalidating archives containing
+ *  other containers. Arrays of arithmetic types (such as the words of a @ref Container::BitVector "BitVector" or the contents
+ *  of a memory buffer) are copied in bulk.
+ *
+ *  Objects are saved with a @ref Writer and loaded with a @ref Reader in the same order:
+ *
+ * @code
+ *  Sawyer::Container::Map<std::string, int> map = ...;
+ *  Sawyer::Container::BitVector bits = ...;
+ *
+ *  std::ofstream out("data.bin", std::ios::binary);
+ *  Sawyer::BinaryArchive::Writer writer(out);
+ *  writer <<map <<bits;
+ *  writer.flush();
+ *
+ *  std::ifstream in("data.bin", std::ios::binary);
+ *  Sawyer::BinaryArchive::Reader reader(in);
+ *  reader >>map >>bits;
+ * @endcode
+ *
+ *  Support for other types is added by declaring @c save and @c load overloads in the type's namespace or in this namespace,
+ *  implemented in terms of the @ref Writer and @ref Reader operators. */
+namespace BinaryArchive {
+
+/** Version number of the archive format written by this library. */
+static const boost::uint32_t FORMAT_VERSION = 1;
+
+/** Error reading or writing an archive. */
+class Error: public Exception::RuntimeError {
+public:
+    /** Construct an error with the specified message. */
+    explicit Error(const std::string &mesg)
+        : Exception::RuntimeError(mesg) {}
+    ~Error() throw () {}
+};
+
+/** Type used to store an integer in an archive.
+ *
+ *  Integer types whose width differs between hosts, namely @c long and <code>unsigned long</code> (and therefore usually @c
+ *  size_t), are stored as 64 bits. Other integers are stored at their own width. */
+template<class T>
+struct StoredInteger {
+    typedef T type;
+};
+
+template<>
+struct StoredInteger<long> {
+    typedef boost::int64_t type;
+};
+
+template<>
+struct StoredInteger<unsigned long> {
+    typedef boost::uint64_t type;
+};
+
+/** Whether values of a type are stored in archives as their little-endian bytes.
+ *
+ *  On little-endian hosts, arrays of such values are copied to and from the archive in bulk. */
+template<class T>
+struct IsBulk {
+    static const bool value = boost::is_arithmetic<T>::value && !boost::is_same<T, bool>::value &&
+                              sizeof(T) == sizeof(typename StoredInteger<T>::type);
+};
+
+/** Whether the host stores integers with their least significant byte first. */
+inline bool
+isLittleEndianHost() {
+    const boost::uint16_t one = 1;
+    unsigned char firstByte = 0;
+    memcpy(&firstByte, &one, 1);
+    return 1 == firstByte;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Writer
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Writes objects to a binary archive.
+ *
+ *  The writer buffers its output and writes it to the underlying stream when the buffer fills, when @ref flush is called, or
+ *  when the writer is destroyed. Errors writing to the stream are reported by throwing an @ref Error, except from the
+ *  destructor where they're ignored; therefore callers that care about errors should flush explicitly. */
+class Writer {
+    std::ostream &stream_;
+    std::vector<char> buffer_;
+    size_t nBuffered_;
+    boost::uint64_t nWritten_;                          // total bytes written, including those still buffered
+
+public:
+    /** Construct a writer and emit the archive header. */
+    explicit Writer(std::ostream &stream, size_t bufferSize = 65536)
+        : stream_(stream), buffer_(std::max(bufferSize, (size_t)64)), nBuffered_(0), nWritten_(0) {
+        writeBytes("SAWYERBA", 8);
+        writeInteger(FORMAT_VERSION);
+    }
+
+    ~Writer() {
+        try {
+            flush();
+        } catch (...) {
+        }
+    }
+
+    /** Write buffered data to the stream. */
+    void flush() {
+        if (nBuffered_ > 0) {
+            size_t n = nBuffered_;
+            nBuffered_ = 0;
+            writeStream(&buffer_[0], n);
+        }
+        stream_.flush();
+        if (!stream_.good())
+            throw Error("binary archive write failed");
+    }
+
+    /** Total number of bytes written so far, including the header. */
+    boost::uint64_t nBytes() const {
+        return nWritten_;
+    }
+
+    /** Write raw bytes. */
+    void writeBytes(const void *data, size_t nBytes) {
+        if (nBuffered_ + nBytes > buffer_.size()) {
+            if (nBuffered_ > 0) {
+                size_t n = nBuffered_;
+                nBuffered_ = 0;
+                writeStream(&buffer_[0], n);
+            }
+            if (nBytes >= buffer_.size()) {
+                writeStream(static_cast<const char*>(data), nBytes);
+                nWritten_ += nBytes;
+                return;
+            }
+        }
+        memcpy(&buffer_[nBuffered_], data, nBytes);
+        nBuffered_ += nBytes;
+        nWritten_ += nBytes;
+    }
+
+    /** Write an integer as little-endian bytes. */
+    template<class T>
+    void writeInteger(T value) {
+        typedef typename boost::uint_t<8 * sizeof(T)>::exact Bits;
+        Bits bits = (Bits)value;
+        unsigned char bytes[sizeof(T)];
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bytes[i] = (unsigned char)(bits & 0xff);
+            bits = (Bits)(bits >> 8);
+        }
+        writeBytes(bytes, sizeof bytes);
+    }
+
+    /** Write a size or count.
+     *
+     *  Sizes are always stored as 64-bit integers. */
+    void writeSize(size_t n) {
+        writeInteger((boost::uint64_t)n);
+    }
+
+    /** Write a container's record version number. */
+    void writeVersion(boost::uint32_t version) {
+        writeInteger(version);
+    }
+
+    /** Write an array of values in bulk. */
+    template<class T>
+    typename boost::enable_if_c<IsBulk<T>::value>::type
+    writeArray(const T *values, size_t n) {
+        if (isLittleEndianHost()) {
+            writeBytes(values, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i)
+                *this <<values[i];
+        }
+    }
+
+    /** Save an object. */
+    template<class T>
+    Writer& operator<<(const T &value) {
+        save(*this, value);
+        return *this;
+    }
+
+private:
+    // Write directly to the stream.
+    void writeStream(const char *data, size_t nBytes) {
+        stream_.write(data, nBytes);
+        if (!stream_.good())
+            throw Error("binary archive write failed");
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Reader
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Reads objects from a binary archive.
+ *
+ *  The reader checks the archive header when it's constructed. Malformed, truncated, or newer-version input is reported by
+ *  throwing an @ref Error. The reader may read past the end of the archive into its buffer, therefore the stream should not
+ *  be used for other purposes afterward. */
+class Reader {
+    std::istream &stream_;
+    std::vector<char> buffer_;
+    size_t at_;                                         // next unread byte in buffer_
+    size_t nBuffered_;                                  // number of valid bytes in buffer_
+    boost::uint32_t formatVersion_;
+
+public:
+    /** Largest vector, in bytes, that is allocated before its data is read. */
+    static const size_t MAX_PREALLOCATION = 64 * 1024 * 1024;
+
+    /** Construct a reader and check the archive header. */
+    explicit Reader(std::istream &stream, size_t bufferSize = 65536)
+        : stream_(stream), buffer_(std::max(bufferSize, (size_t)64)), at_(0), nBuffered_(0), formatVersion_(0) {
+        char magic[8];
+        readBytes(magic, 8);
+        if (memcmp(magic, "SAWYERBA", 8) != 0)
+            throw Error("not a binary archive");
+        formatVersion_ = readInteger<boost::uint32_t>();
+        if (formatVersion_ > FORMAT_VERSION)
+            throw Error("binary archive format version " + boost::lexical_cast<std::string>(formatVersion_) +
+                        " is not supported");
+    }
+
+    /** Format version number from the archive header. */
+    boost::uint32_t formatVersion() const {
+        return formatVersion_;
+    }
+
+    /** Read raw bytes. */
+    void readBytes(void *data, size_t nBytes) {
+        char *dst = static_cast<char*>(data);
+        while (nBytes > 0) {
+            if (at_ == nBuffered_) {
+                if (nBytes >= buffer_.size()) {
+                    // Large reads go directly to the destination.
+                    stream_.read(dst, nBytes);
+                    if ((size_t)stream_.gcount() != nBytes)
+                        throw Error("binary archive is truncated");
+                    return;
+                }
+                stream_.read(&buffer_[0], buffer_.size());
+                nBuffered_ = stream_.gcount();
+                at_ = 0;
+                if (0 == nBuffered_)
+                    throw Error("binary archive is truncated");
+            }
+            size_t n = std::min(nBytes, nBuffered_ - at_);
+            memcpy(dst, &buffer_[at_], n);
+            at_ += n;
+            dst += n;
+            nBytes -= n;
+        }
+    }
+
+    /** Read a little-endian integer. */
+    template<class T>
+    T readInteger() {
+        typedef typename boost::uint_t<8 * sizeof(T)>::exact Bits;
+        unsigned char bytes[sizeof(T)];
+        readBytes(bytes, sizeof bytes);
+        Bits bits = 0;
+        for (size_t i = sizeof(T); i > 0; --i)
+            bits = (Bits)((bits << 8) | bytes[i-1]);
+        return (T)bits;
+    }
+
+    /** Read a size or count. */
+    size_t readSize() {
+        boost::uint64_t n = readInteger<boost::uint64_t>();
+        if (n > (boost::uint64_t)(size_t)(-1))
+            throw Error("binary archive size is too large for this host");
+        return n;
+    }
+
+    /** Read a container's record version number.
+     *
+     *  Throws an @ref Error if the version is newer than @p maxVersion, the newest version understood by the caller. */
+    boost::uint32_t readVersion(boost::uint32_t maxVersion) {
+        boost::uint32_t version = readInteger<boost::uint32_t>();
+        if (version > maxVersion)
+            throw Error("binary archive record version " + boost::lexical_cast<std::string>(version) + " is not supported");
+        return version;
+    }
+
+    /** Read an array of values in bulk into existing storage. */
+    template<class T>
+    typename boost::enable_if_c<IsBulk<T>::value>::type
+    readArray(T *values, size_t n) {
+        if (isLittleEndianHost()) {
+            readBytes(values, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i)
+                *this >>values[i];
+        }
+    }
+
+    /** Read an array of values in bulk and append them to a vector.
+     *
+     *  Counts up to @ref MAX_PREALLOCATION bytes are allocated all at once. Larger counts cause the vector to grow as data is
+     *  read so that a corrupt count fails with a truncation error rather than a huge allocation. */
+    template<class T>
+    typename boost::enable_if_c<IsBulk<T>::value>::type
+    readArray(std::vector<T> &values, size_t n) {
+        static const size_t CHUNK = MAX_PREALLOCATION / sizeof(T);
+        if (n <= CHUNK)
+            values.reserve(values.size() + n);
+        while (n > 0) {
+            size_t chunk = std::min(n, CHUNK);
+            size_t offset = values.size();
+            values.resize(offset + chunk);
+            readArray(&values[offset], chunk);
+            n -= chunk;
+        }
+    }
+
+    /** Load an object. */
+    template<class T>
+    Reader& operator>>(T &value) {
+        load(*this, value);
+        return *this;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Primitive types
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Save or load an integer.
+ *
+ *  Integers are stored at the width given by @ref StoredInteger. Loading a value that doesn't fit in the host's type throws an
+ *  @ref Error.
+ *
+ * @{ */
+template<class T>
+typename boost::enable_if_c<boost::is_integral<T>::value && !boost::is_same<T, bool>::value>::type
+save(Writer &w, const T &value) {
+    w.writeInteger((typename StoredInteger<T>::type)value);
+}
+
+template<class T>
+typename boost::enable_if_c<boost::is_integral<T>::value && !boost::is_same<T, bool>::value>::type
+load(Reader &r, T &value) {
+    typedef typename StoredInteger<T>::type Stored;
+    Stored stored = r.readInteger<Stored>();
+    value = (T)stored;
+    if ((Stored)value != stored)
+        throw Error("binary archive integer is too large for this host");
+}
+/** @} */
+
+/** Save or load a floating-point value.
+ *
+ *  Floating-point values are stored as the little-endian bytes of their IEEE representation.
+ *
+ * @{ */
+template<class T>
+typename boost::enable_if_c<boost::is_floating_point<T>::value>::type
+save(Writer &w, const T &value) {
+    typedef typename boost::uint_t<8 * sizeof(T)>::exact Bits;
+    Bits bits;
+    memcpy(&bits, &value, sizeof bits);
+    w.writeInteger(bits);
+}
+
+template<class T>
+typename boost::enable_if_c<boost::is_floating_point<T>::value>::type
+load(Reader &r, T &value) {
+    typedef typename boost::uint_t<8 * sizeof(T)>::exact Bits;
+    Bits bits = r.readInteger<Bits>();
+    memcpy(&value, &bits, sizeof value);
+}
+/** @} */
+
+/** Save or load a Boolean value as one byte.
+ *
+ * @{ */
+inline void
+save(Writer &w, bool value) {
+    w.writeInteger((boost::uint8_t)(value ? 1 : 0));
+}
+
+inline void
+load(Reader &r, bool &value) {
+    value = r.readInteger<boost::uint8_t>() != 0;
+}
+/** @} */
+
+/** Save or load a string as its length followed by its characters.
+ *
+ * @{ */
+inline void
+save(Writer &w, const std::string &s) {
+    w.writeSize(s.size());
+    w.writeBytes(s.data(), s.size());
+}
+
+inline void
+load(Reader &r, std::string &s) {
+    size_t n = r.readSize();
+    s.clear();
+    char buf[4096];
+    while (n > 0) {
+        size_t chunk = std::min(n, sizeof buf);
+        r.readBytes(buf, chunk);
+        s.append(buf, chunk);
+        n -= chunk;
+    }
+}
+/** @} */
+
+/** Save or load the @ref Nothing type, which has no data.
+ *
+ *  Graphs use this type for vertices and edges that have no values.
+ *
+ * @{ */
+inline void save(Writer&, const Nothing&) {}
+inline void load(Reader&, Nothing&) {}
+/** @} */
+
+/** Save or load a pair.
+ *
+ * @{ */
+template<class T, class U>
+void
+save(Writer &w, const std::pair<T, U> &pair) {
+    w <<pair.first <<pair.second;
+}
+
+template<class T, class U>
+void
+load(Reader &r, std::pair<T, U> &pair) {
+    r >>pair.first >>pair.second;
+}
+/** @} */
+
+/** Save or load a vector.
+ *
+ *  Vectors of arithmetic types are copied in bulk.
+ *
+ * @{ */
+template<class T, class A>
+typename boost::enable_if_c<IsBulk<T>::value>::type
+save(Writer &w, const std::vector<T, A> &values) {
+    w.writeSize(values.size());
+    if (!values.empty())
+        w.writeArray(&values[0], values.size());
+}
+
+template<class T, class A>
+typename boost::disable_if_c<IsBulk<T>::value>::type
+save(Writer &w, const std::vector<T, A> &values) {
+    w.writeSize(values.size());
+    BOOST_FOREACH (const T &value, values)
+        w <<value;
+}
+
+template<class T>
+typename boost::enable_if_c<IsBulk<T>::value>::type
+load(Reader &r, std::vector<T> &values) {
+    size_t n = r.readSize();
+    values.clear();
+    r.readArray(values, n);
+}
+
+template<class T>
+typename boost::disable_if_c<IsBulk<T>::value>::type
+load(Reader &r, std::vector<T> &values) {
+    size_t n = r.readSize();
+    values.clear();
+    for (size_t i = 0; i < n; ++i) {
+        values.push_back(T());
+        r >>values.back();
+    }
+}
+/** @} */
+
+/** Save or load an optional value.
+ *
+ * @{ */
+template<class T>
+void
+save(Writer &w, const Optional<T> &value) {
+    w <<(bool)value;
+    if (value)
+        w <<*value;
+}
+
+template<class T>
+void
+load(Reader &r, Optional<T> &value) {
+    bool exists = false;
+    r >>exists;
+    if (exists) {
+        T v;
+        r >>v;
+        value = v;
+    } else {
+        value = Nothing();
+    }
+}
+/** @} */
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Containers
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Save or load a bit vector.
+ *
+ *  The bits are stored as the vector's size followed by its words in bulk.
+ *
+ * @{ */
+inline void
+save(Writer &w, const Container::BitVector &bits) {
+    w.writeVersion(1);
+    w.writeSize(bits.size());
+    w.writeSize(bits.dataSize());
+    if (bits.dataSize() > 0)
+        w.writeArray(bits.data(), bits.dataSize());
+}
+
+inline void
+load(Reader &r, Container::BitVector &bits) {
+    r.readVersion(1);
+    size_t nBits = r.readSize();
+    size_t nWords = r.readSize();
+    if (Container::BitVectorSupport::numberOfWords<Container::BitVector::Word>(nBits) != nWords)
+        throw Error("binary archive bit vector is malformed");
+    bits.resize(nBits);
+    if (nWords > 0)
+        r.readArray(bits.data(), nWords);
+}
+/** @} */
+
+/** Save or load a map.
+ *
+ * @{ */
+template<class K, class T, class Cmp, class Alloc>
+void
+save(Writer &w, const Container::Map<K, T, Cmp, Alloc> &map) {
+    w.writeVersion(1);
+    typedef typename Container::Map<K, T, Cmp, Alloc>::Node Node;
+    w.writeSize(map.size());
+    BOOST_FOREACH (const Node &node, map.nodes())
+        w <<node.key() <<node.value();
+}
+
+template<class K, class T, class Cmp, class Alloc>
+void
+load(Reader &r, Container::Map<K, T, Cmp, Alloc> &map) {
+    r.readVersion(1);
+    size_t n = r.readSize();
+    map.clear();
+    for (size_t i = 0; i < n; ++i) {
+        K key;
+        T value;
+        r >>key >>value;
+        map.insert(key, value);
+    }
+}
+/** @} */
+
+/** Save or load a set.
+ *
+ * @{ */
+template<class T, class C, class A>
+void
+save(Writer &w, const Container::Set<T, C, A> &set) {
+    w.writeVersion(1);
+    w.writeSize(set.size());
+    BOOST_FOREACH (const T &value, set.values())
+        w <<value;
+}
+
+template<class T, class C, class A>
+void
+load(Reader &r, Container::Set<T, C, A> &set) {
+    r.readVersion(1);
+    size_t n = r.readSize();
+    set.clear();
+    for (size_t i = 0; i < n; ++i) {
+        T value;
+        r >>value;
+        set.insert(value);
+    }
+}
+/** @} */
+
+/** Save or load an interval.
+ *
+ * @{ */
+template<class T>
+void
+save(Writer &w, const Container::Interval<T> &interval) {
+    w <<interval.isEmpty();
+    if (!interval.isEmpty())
+        w <<interval.least() <<interval.greatest();
+}
+
+template<class T>
+void
+load(Reader &r, Container::Interval<T> &interval) {
+    bool isEmpty = true;
+    r >>isEmpty;
+    if (isEmpty) {
+        interval = Container::Interval<T>();
+    } else {
+        T least, greatest;
+        r >>least >>greatest;
+        if (least > greatest)
+            throw Error("binary archive interval is malformed");
+        interval = Container::Interval<T>::hull(least, greatest);
+    }
+}
+/** @} */
+
+/** Save or load an interval set.
+ *
+ * @{ */
+template<class I>
+void
+save(Writer &w, const Container::IntervalSet<I> &set) {
+    w.writeVersion(1);
+    w.writeSize(set.nIntervals());
+    BOOST_FOREACH (const I &interval, set.intervals())
+        w <<interval;
+}
+
+template<class I>
+void
+load(Reader &r, Container::IntervalSet<I> &set) {
+    r.readVersion(1);
+    size_t n = r.readSize();
+    set.clear();
+    for (size_t i = 0; i < n; ++i) {
+        I interval;
+        r >>interval;
+        set.insert(interval);
+    }
+}
+/** @} */
+
+/** Save or load an interval map.
+ *
+ *  The map's nodes are saved in order. When loading, they're inserted in the same order, so the map's merge policy produces
+ *  the same nodes.
+ *
+ * @{ */
+template<class I, class T, class Policy>
+void
+save(Writer &w, const Container::IntervalMap<I, T, Policy> &map) {
+    w.writeVersion(1);
+    typedef typename Container::IntervalMap<I, T, Policy>::Node Node;
+    w.writeSize(map.nIntervals());
+    BOOST_FOREACH (const Node &node, map.nodes())
+        w <<node.key() <<node.value();
+}
+
+template<class I, class T, class Policy>
+void
+load(Reader &r, Container::IntervalMap<I, T, Policy> &map) {
+    r.readVersion(1);
+    size_t n = r.readSize();
+    map.clear();
+    for (size_t i = 0; i < n; ++i) {
+        I interval;
+        T value;
+        r >>interval >>value;
+        map.insert(interval, value);
+    }
+}
+/** @} */
+
+/** Save or load a graph.
+ *
+ *  Vertices and edges are saved in order of their ID numbers, edges as the ID numbers of their endpoints followed by their
+ *  value. A loaded graph therefore has the same ID numbers as the saved graph.
+ *
+ * @{ */
+template<class V, class E, class VKey, class EKey, class Alloc>
+void
+save(Writer &w, const Container::Graph<V, E, VKey, EKey, Alloc> &graph) {
+    typedef Container::Graph<V, E, VKey, EKey, Alloc> Graph;
+    w.writeVersion(1);
+    w.writeSize(graph.nVertices());
+    for (size_t i = 0; i < graph.nVertices(); ++i)
+        w <<graph.findVertex(i)->value();
+    w.writeSize(graph.nEdges());
+    for (size_t i = 0; i < graph.nEdges(); ++i) {
+        typename Graph::ConstEdgeIterator edge = graph.findEdge(i);
+        w.writeSize(edge->source()->id());
+        w.writeSize(edge->target()->id());
+        w <<edge->value();
+    }
+}
+
+template<class V, class E, class VKey, class EKey, class Alloc>
+void
+load(Reader &r, Container::Graph<V, E, VKey, EKey, Alloc> &graph) {
+    r.readVersion(1);
+    graph.clear();
+    size_t nVertices = r.readSize();
+    for (size_t i = 0; i < nVertices; ++i) {
+        V value;
+        r >>value;
+        graph.insertVertex(value);
+    }
+    size_t nEdges = r.readSize();
+    for (size_t i = 0; i < nEdges; ++i) {
+        size_t srcId = r.readSize();
+        size_t tgtId = r.readSize();
+        if (srcId >= graph.nVertices() || tgtId >= graph.nVertices())
+            throw Error("binary archive graph edge has invalid endpoints");
+        E value;
+        r >>value;
+        graph.insertEdge(graph.findVertex(srcId), graph.findVertex(tgtId), value);
+    }
+}
+/** @} */
+
+/** Number of values moved at a time when saving or loading a buffer. */
+static const size_t BUFFER_CHUNK = 8192;
+
+// Allocate a buffer for loading, reporting sizes that can't be allocated as archive errors.
+template<class A, class T>
+typename Container::Buffer<A, T>::Ptr
+allocateBuffer(size_t size) {
+    if ((size_t)(A)size != size)
+        throw Error("binary archive buffer is too large for its address type");
+    try {
+        return Container::AllocatingBuffer<A, T>::instance(size);
+    } catch (const std::bad_alloc&) {
+    } catch (const std::length_error&) {
+    }
+    throw Error("binary archive buffer is too large to allocate");
+}
+
+/** Save or load a buffer's contents.
+ *
+ *  Only the data is saved, and a loaded buffer is always an @ref Container::AllocatingBuffer "AllocatingBuffer". Buffers of
+ *  arithmetic types are copied in bulk, and other values are saved and loaded one at a time. Data is moved in chunks of at
+ *  most @ref BUFFER_CHUNK values, so loading a buffer needs little memory beyond the buffer itself.
+ *
+ * @{ */
+template<class A, class T>
+typename boost::enable_if_c<IsBulk<T>::value>::type
+saveBuffer(Writer &w, const typename Container::Buffer<A, T>::Ptr &buffer) {
+    ASSERT_not_null(buffer);
+    A size = buffer->size();
+    w.writeSize(size);
+    if (buffer->data() != NULL) {
+        w.writeArray(buffer->data(), size);
+    } else {
+        std::vector<T> chunk(std::min(size, (A)BUFFER_CHUNK));
+        for (A at = 0; at < size; /*void*/) {
+            A n = buffer->read(&chunk[0], at, std::min(size - at, (A)chunk.size()));
+            ASSERT_require(n > 0);
+            w.writeArray(&chunk[0], n);
+            at += n;
+        }
+    }
+}
+
+template<class A, class T>
+typename boost::disable_if_c<IsBulk<T>::value>::type
+saveBuffer(Writer &w, const typename Container::Buffer<A, T>::Ptr &buffer) {
+    ASSERT_not_null(buffer);
+    A size = buffer->size();
+    w.writeSize(size);
+    std::vector<T> chunk(std::min(size, (A)BUFFER_CHUNK));
+    for (A at = 0; at < size; /*void*/) {
+        A n = buffer->read(&chunk[0], at, std::min(size - at, (A)chunk.size()));
+        ASSERT_require(n > 0);
+        for (A i = 0; i < n; ++i)
+            w <<chunk[i];
+        at += n;
+    }
+}
+
+template<class A, class T>
+typename boost::enable_if_c<IsBulk<T>::value, typename Container::Buffer<A, T>::Ptr>::type
+loadBuffer(Reader &r) {
+    typename Container::Buffer<A, T>::Ptr buffer = allocateBuffer<A, T>(r.readSize());
+    A size = buffer->size();
+    std::vector<T> chunk(std::min(size, (A)BUFFER_CHUNK));
+    for (A at = 0; at < size; /*void*/) {
+        A n = std::min(size - at, (A)chunk.size());
+        r.readArray(&chunk[0], n);
+        buffer->write(&chunk[0], at, n);
+        at += n;
+    }
+    return buffer;
+}
+
+template<class A, class T>
+typename boost::disable_if_c<IsBulk<T>::value, typename Container::Buffer<A, T>::Ptr>::type
+loadBuffer(Reader &r) {
+    typename Container::Buffer<A, T>::Ptr buffer = allocateBuffer<A, T>(r.readSize());
+    A size = buffer->size();
+    std::vector<T> chunk(std::min(size, (A)BUFFER_CHUNK));
+    for (A at = 0; at < size; /*void*/) {
+        A n = std::min(size - at, (A)chunk.size());
+        for (A i = 0; i < n; ++i)
+            r >>chunk[i];
+        buffer->write(&chunk[0], at, n);
+        at += n;
+    }
+    return buffer;
+}
+/** @} */
+
+/** Save or load an address segment.
+ *
+ *  The segment's entire buffer is saved with the segment. Segments that share buffers should be saved as part of an @ref
+ *  Container::AddressMap "AddressMap", which saves each buffer only once.
+ *
+ * @{ */
+template<class A, class T>
+void
+save(Writer &w, const Container::AddressSegment<A, T> &segment) {
+    w.writeVersion(1);
+    w <<segment.offset() <<segment.accessibility() <<segment.name();
+    w <<(bool)segment.buffer();
+    if (segment.buffer())
+        saveBuffer<A, T>(w, segment.buffer());
+}
+
+template<class A, class T>
+void
+load(Reader &r, Container::AddressSegment<A, T> &segment) {
+    r.readVersion(1);
+    A offset;
+    unsigned accessibility;
+    std::string name;
+    bool hasBuffer = false;
+    r >>offset >>accessibility >>name >>hasBuffer;
+    typename Container::Buffer<A, T>::Ptr buffer;
+    if (hasBuffer)
+        buffer = loadBuffer<A, T>(r);
+    segment = Container::AddressSegment<A, T>(buffer, offset, accessibility, name);
+}
+/** @} */
+
+/** Save or load an address map.
+ *
+ *  Each distinct buffer is saved once, followed by the map's nodes, which refer to the buffers by index. Therefore buffers
+ *  that are shared by more than one segment are also shared after loading.
+ *
+ * @{ */
+template<class A, class T>
+void
+save(Writer &w, const Container::AddressMap<A, T> &map) {
+    typedef Container::AddressMap<A, T> Map;
+    typedef typename Container::Buffer<A, T>::Ptr BufferPtr;
+    w.writeVersion(1);
+
+    Container::Map<const Container::Buffer<A, T>*, size_t> bufferIds;
+    std::vector<BufferPtr> buffers;
+    BOOST_FOREACH (const typename Map::Node &node, map.nodes()) {
+        const BufferPtr &buffer = node.value().buffer();
+        ASSERT_not_null(buffer);
+        if (!bufferIds.exists(buffer.getRawPointer())) {
+            bufferIds.insert(buffer.getRawPointer(), buffers.size());
+            buffers.push_back(buffer);
+        }
+    }
+    w.writeSize(buffers.size());
+    BOOST_FOREACH (const BufferPtr &buffer, buffers)
+        saveBuffer<A, T>(w, buffer);
+
+    w.writeSize(map.nIntervals());
+    BOOST_FOREACH (const typename Map::Node &node, map.nodes()) {
+        const Container::AddressSegment<A, T> &segment = node.value();
+        w <<node.key() <<segment.offset() <<segment.accessibility() <<segment.name();
+        w.writeSize(bufferIds[segment.buffer().getRawPointer()]);
+    }
+}
+
+template<class A, class T>
+void
+load(Reader &r, Container::AddressMap<A, T> &map) {
+    typedef typename Container::Buffer<A, T>::Ptr BufferPtr;
+    r.readVersion(1);
+    map.clear();
+
+    size_t nBuffers = r.readSize();
+    std::vector<BufferPtr> buffers;
+    for (size_t i = 0; i < nBuffers; ++i)
+        buffers.push_back(loadBuffer<A, T>(r));
+
+    size_t nNodes = r.readSize();
+    for (size_t i = 0; i < nNodes; ++i) {
+        Container::Interval<A> interval;
+        A offset;
+        unsigned accessibility;
+        std::string name;
+        r >>interval >>offset >>accessibility >>name;
+        size_t bufferId = r.readSize();
+        if (bufferId >= buffers.size())
+            throw Error("binary archive address map refers to an invalid buffer");
+        map.insert(interval, Container::AddressSegment<A, T>(buffers[bufferId], offset, accessibility, name));
+    }
+}
+/** @} */
+
+} // namespace
+} // namespace
+
+#endif
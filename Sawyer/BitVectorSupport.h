@@ -63,7 +63,7 @@ size_t numberOfWords(size_t nbits) {
  *  more-significant direction. */
 template<class Word>
 Word bitMask(size_t offset, size_t nbits) {
-    ASSERT_require(offset + nbits <= bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, offset + nbits <= bitsPerWord<Word>::value);
     Word mask = nbits == bitsPerWord<Word>::value ? Word(-1) : (Word(1) << nbits) - 1;
     return mask << offset;
 }
@@ -75,15 +75,15 @@ Word bitMask(size_t offset, size_t nbits) {
  *  @{ */
 template<class Processor, class Word>
 bool processWord(Processor &processor, const Word &word, size_t shift, size_t nbits) {
-    ASSERT_require(shift < bitsPerWord<Word>::value);
-    ASSERT_require(nbits <= bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, shift < bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word>::value);
     const Word tmp = word >> shift;
     return processor(tmp, nbits);
 }
 
 template<class Processor, class Word>
 bool processWord(Processor &processor, Word &word, size_t shift, size_t nbits) {
-    ASSERT_require(shift < bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, shift < bitsPerWord<Word>::value);
     Word tmp = word >> shift;
     bool retval = processor(tmp, nbits);
     word &= ~bitMask<Word>(shift, nbits);
@@ -93,8 +93,8 @@ bool processWord(Processor &processor, Word &word, size_t shift, size_t nbits) {
 
 template<class Processor, class Word>
 bool processWord(Processor &processor, const Word &src, Word &dst, size_t shift, size_t nbits) {
-    ASSERT_require(shift < bitsPerWord<Word>::value);
-    ASSERT_require(nbits <= bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, shift < bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word>::value);
     const Word tmpSrc = src >> shift;
     Word tmpDst = dst >> shift;
     bool retval = processor(tmpSrc, tmpDst, nbits);
@@ -104,8 +104,8 @@ bool processWord(Processor &processor, const Word &src, Word &dst, size_t shift,
 }
 template<class Processor, class Word>
 bool processWord(Processor &processor, Word &w1, Word &w2, size_t shift, size_t nbits) {
-    ASSERT_require(shift < bitsPerWord<Word>::value);
-    ASSERT_require(nbits <= bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, shift < bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word>::value);
     Word tmp1 = w1 >> shift;
     Word tmp2 = w2 >> shift;
     bool retval = processor(tmp1, tmp2, nbits);
@@ -118,8 +118,8 @@ bool processWord(Processor &processor, Word &w1, Word &w2, size_t shift, size_t
 }
 template<class Processor, class Word>
 bool processWord(Processor &processor, const Word &w1, const Word &w2, size_t shift, size_t nbits) {
-    ASSERT_require(shift < bitsPerWord<Word>::value);
-    ASSERT_require(nbits <= bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, shift < bitsPerWord<Word>::value);
+    ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word>::value);
     Word tmp1 = w1 >> shift;
     Word tmp2 = w2 >> shift;
     return processor(tmp1, tmp2, nbits);
@@ -212,7 +212,7 @@ void traverse(Processor &processor, Word *words, const BitRange &range, LowToHig
     bool done = false;
     for (size_t wordIdx = wordIndex<Word>(range.least()); !done && nRemaining > 0; ++wordIdx) {
         size_t nbits = std::min(bitsPerWord<Word>::value - offsetInWord, nRemaining);
-        ASSERT_require(nbits > 0);
+        ASSERT_hot_require(BITVECTOR, nbits > 0);
         done = processWord(processor, words[wordIdx], offsetInWord, nbits);
         offsetInWord = 0;                               // only the first word has an internal bit offset
         nRemaining -= nbits;
@@ -232,19 +232,19 @@ void traverse(Processor &processor, Word *words, const BitRange &range, HighToLo
     for (size_t wordIdx=lastWordIdx; !done && nRemaining > 0; --wordIdx) {
         size_t nbits;
         if (wordIdx == firstWordIdx) {
-            ASSERT_require(nRemaining <= bitsPerWord<Word>::value);
+            ASSERT_hot_require(BITVECTOR, nRemaining <= bitsPerWord<Word>::value);
             nbits = nRemaining;
         } else if (wordIdx < lastWordIdx) {
-            ASSERT_require(nRemaining > bitsPerWord<Word>::value);
+            ASSERT_hot_require(BITVECTOR, nRemaining > bitsPerWord<Word>::value);
             nbits = bitsPerWord<Word>::value;
         } else {
-            ASSERT_require(wordIdx==lastWordIdx);
-            ASSERT_require(wordIdx>firstWordIdx);
+            ASSERT_hot_require(BITVECTOR, wordIdx==lastWordIdx);
+            ASSERT_hot_require(BITVECTOR, wordIdx>firstWordIdx);
             size_t nBitsToLeft = (bitsPerWord<Word>::value - offsetInWord) +
                                  (lastWordIdx-firstWordIdx-1) * bitsPerWord<Word>::value;
-            ASSERT_require(nRemaining > nBitsToLeft);
+            ASSERT_hot_require(BITVECTOR, nRemaining > nBitsToLeft);
             nbits = nRemaining - nBitsToLeft;
-            ASSERT_require(nbits <= bitsPerWord<Word>::value);
+            ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word>::value);
         }
         done = processWord(processor, words[wordIdx], wordIdx==firstWordIdx ? offsetInWord : 0, nbits);
         nRemaining -= nbits;
@@ -275,9 +275,9 @@ void traverse2(Processor &processor, Word1 *vec1, const BitRange &range1, Word2
     size_t nRemaining = range2.size();
     bool done = false;
     for (size_t wordIdx=0; !done && nRemaining > 0; ++wordIdx) {
-        ASSERT_require(wordIdx < nWordsTmp);
+        ASSERT_hot_require(BITVECTOR, wordIdx < nWordsTmp);
         size_t nbits = std::min(bitsPerWord<Word2>::value - offsetInWord, nRemaining);
-        ASSERT_require(nbits > 0);
+        ASSERT_hot_require(BITVECTOR, nbits > 0);
         done = processWord(processor, *const_cast<Word1*>(tmp+wordIdx), vec2[wordIdx+vec2WordOffset], offsetInWord, nbits);
         offsetInWord = 0;                               // only the first word has an internal bit offset
         nRemaining -= nbits;
@@ -312,18 +312,18 @@ void traverse2(Processor &processor, Word1 *vec1, const BitRange &range1, Word2
     for (size_t wordIdx=nWordsTmp-1; !done && nRemaining>0; --wordIdx) {
         size_t nbits;
         if (wordIdx == 0) {
-            ASSERT_require(nRemaining <= bitsPerWord<Word2>::value);
+            ASSERT_hot_require(BITVECTOR, nRemaining <= bitsPerWord<Word2>::value);
             nbits = nRemaining;
         } else if (wordIdx < nWordsTmp-1) {
-            ASSERT_require(nRemaining > bitsPerWord<Word2>::value);
+            ASSERT_hot_require(BITVECTOR, nRemaining > bitsPerWord<Word2>::value);
             nbits = bitsPerWord<Word2>::value;
         } else {
-            ASSERT_require(wordIdx==nWordsTmp-1);
-            ASSERT_require(wordIdx>0);
+            ASSERT_hot_require(BITVECTOR, wordIdx==nWordsTmp-1);
+            ASSERT_hot_require(BITVECTOR, wordIdx>0);
             size_t nBitsToLeft = (bitsPerWord<Word2>::value - offsetInWord) + (nWordsTmp-2) * bitsPerWord<Word2>::value;
-            ASSERT_require(nRemaining > nBitsToLeft);
+            ASSERT_hot_require(BITVECTOR, nRemaining > nBitsToLeft);
             nbits = nRemaining - nBitsToLeft;
-            ASSERT_require(nbits <= bitsPerWord<Word2>::value);
+            ASSERT_hot_require(BITVECTOR, nbits <= bitsPerWord<Word2>::value);
         }
         done = processWord(processor, *const_cast<Word1*>(tmp+wordIdx), vec2[wordIdx+vec2WordOffset],
                            wordIdx==0 ? offsetInWord : 0, nbits);
@@ -570,7 +570,7 @@ struct MostSignificantSetBit {
     Optional<size_t> result;
     MostSignificantSetBit(size_t nbits): offset(nbits) {}
     bool operator()(const Word &word, size_t nbits) {
-        ASSERT_require(nbits <= offset);
+        ASSERT_hot_require(BITVECTOR, nbits <= offset);
         offset -= nbits;
         if (0 != (word & bitMask<Word>(0, nbits))) {
             for (size_t i=nbits; i>0; --i) {
@@ -603,7 +603,7 @@ struct MostSignificantClearBit {
     Optional<size_t> result;
     MostSignificantClearBit(size_t nbits): offset(nbits) {}
     bool operator()(const Word &word, size_t nbits) {
-        ASSERT_require(nbits <= offset);
+        ASSERT_hot_require(BITVECTOR, nbits <= offset);
         offset -= nbits;
         if (bitMask<Word>(0, nbits) != (word & bitMask<Word>(0, nbits))) {
             for (size_t i=nbits; i>0; --i) {
@@ -735,7 +735,7 @@ struct MostSignificantDifference {
     Optional<size_t> result;
     MostSignificantDifference(size_t nbits): offset(nbits) {}
     bool operator()(const Word &w1, const Word &w2, size_t nbits) {
-        ASSERT_require(nbits <= offset);
+        ASSERT_hot_require(BITVECTOR, nbits <= offset);
         offset -= nbits;
         Word mask = bitMask<Word>(0, nbits);
         if ((w1 & mask) != (w2 & mask)) {
@@ -1042,7 +1042,7 @@ struct Increment {
     bool carry;
     Increment(): carry(true) {}
     bool operator()(Word &word, size_t nbits) {
-        ASSERT_require(carry);
+        ASSERT_hot_require(BITVECTOR, carry);
         Word mask = bitMask<Word>(0, nbits);
         Word arg1 = word & mask;
         Word sum = arg1 + 1;
@@ -1068,7 +1068,7 @@ struct Decrement {
     bool borrowed;
     Decrement(): borrowed(true) {}
     bool operator()(Word &word, size_t nbits) {
-        ASSERT_require(borrowed);
+        ASSERT_hot_require(BITVECTOR, borrowed);
         Word mask = bitMask<Word>(0, nbits);
         Word arg1 = word & mask;
         borrowed = 0==arg1;
@@ -1332,7 +1332,7 @@ struct ToBytes {
 
     bool operator()(const Word &word, size_t nbits) {
         Word tmp = word;
-        ASSERT_require(nremaining < size_t(8));
+        ASSERT_hot_require(BITVECTOR, nremaining < size_t(8));
         while (nremaining + nbits >= size_t(8)) {
             const size_t nrem = nremaining;             // number left-over bits to use
             const size_t nnew = size_t(8) - nrem;       // number of new bits to use
@@ -1400,7 +1400,7 @@ struct ToString {
     bool operator()(const Word &word, size_t nbits) {
         static const char digits[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
         Word tmp = word & bitMask<Word>(0, nbits);
-        ASSERT_require(nremaining < bitsPerDigit);
+        ASSERT_hot_require(BITVECTOR, nremaining < bitsPerDigit);
         while (nremaining+nbits >= bitsPerDigit) {
             size_t nrem = std::min(nremaining, bitsPerDigit); // number left-over bits to use
             size_t nnew = bitsPerDigit - nrem;                // number of new bits to use
@@ -3,78 +3,225 @@
 
 #include <Sawyer/Sawyer.h>
 #include <Sawyer/SharedPointer.h>
-#include <list>
+#include <Sawyer/Synchronization.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace Sawyer {
 
-// FIXME[Robb Matzke 2014-08-13]: documentation
+/** Ordered list of callbacks.
+ *
+ *  A callback list is intended for hooks that are invoked very often but change rarely. The callbacks are stored contiguously
+ *  in an immutable snapshot. Each modification copies the current snapshot, changes the copy, and publishes a pointer to it,
+ *  so the @ref apply methods need only one atomic load to obtain a snapshot and then iterate over it without locking.
+ *  Therefore a thread can apply the callbacks while other threads add or remove callbacks, and a callback can even modify the
+ *  list that's invoking it; the application that's in progress keeps using the snapshot it started with.
+ *
+ *  Each list counts the applications that are in progress. A snapshot that's replaced while the count is nonzero is retired
+ *  and freed when the count next drops to zero, by whichever thread makes it so. Applying a list therefore costs an
+ *  increment and a decrement of that count, and an empty list is recognized without even that.
+ *
+ *  Modifications are serialized by a mutex. Applying, querying, and copying a list don't lock it, except that the last
+ *  application to finish locks it briefly if it needs to free retired snapshots. Copying a callback list is cheap because
+ *  the copy shares the current snapshot. */
 template<class Callback>
 class Callbacks {
 private:
-    typedef std::list<Callback> CbList;
-    CbList callbacks_;
+    typedef std::vector<Callback> CbList;
+
+    // Immutable list of callbacks shared by the lists that were copied from one another.
+    struct Snapshot {
+        CbList callbacks;
+        mutable std::atomic<size_t> nRefs;              // number of lists referring to this snapshot, current or retired
+
+        explicit Snapshot(const CbList &callbacks)
+            : callbacks(callbacks), nRefs(1) {}
+    };
+
+    // Counts an application (or other unlocked read) of a list while it's in progress.
+    class ReadGuard {
+        const Callbacks &cbs_;
+    public:
+        explicit ReadGuard(const Callbacks &cbs)
+            : cbs_(cbs) {
+            cbs_.nReaders_.fetch_add(1);
+        }
+        ~ReadGuard() {
+            if (1 == cbs_.nReaders_.fetch_sub(1) && cbs_.hasRetired_.load())
+                cbs_.reclaim();
+        }
+    private:
+        ReadGuard(const ReadGuard&);
+        ReadGuard& operator=(const ReadGuard&);
+    };
+
+    // Holds a reference to a snapshot.
+    class Reference {
+        const Snapshot *snapshot_;
+    public:
+        explicit Reference(const Snapshot *snapshot)
+            : snapshot_(snapshot) {}
+        ~Reference() {
+            release(snapshot_);
+        }
+        const Snapshot* get() const {
+            return snapshot_;
+        }
+    private:
+        Reference(const Reference&);
+        Reference& operator=(const Reference&);
+    };
+
+    mutable SAWYER_THREAD_TRAITS::Mutex mutex_;         // serializes modifications
+    std::atomic<const Snapshot*> current_;              // current list of callbacks, null if empty
+    mutable std::atomic<size_t> nReaders_;              // number of applications in progress
+    mutable std::vector<const Snapshot*> retired_;      // replaced snapshots that might still be in use; protected by mutex_
+    mutable std::atomic<bool> hasRetired_;              // whether retired_ is non-empty
 
 public:
+    /** Construct an empty list of callbacks. */
+    Callbacks()
+        : current_(nullptr), nReaders_(0), hasRetired_(false) {}
+
+    /** Copy constructor.
+     *
+     *  The new list shares the other list's current snapshot. */
+    Callbacks(const Callbacks &other)
+        : current_(other.acquire()), nReaders_(0), hasRetired_(false) {}
+
+    ~Callbacks() {
+        release(current_.load());
+        for (const Snapshot *snapshot: retired_)
+            release(snapshot);
+    }
+
+    /** Assignment.
+     *
+     *  This is a modification of this list, and is therefore safe to perform while other threads are applying callbacks. */
+    Callbacks& operator=(const Callbacks &other) {
+        if (this != &other && !(isEmpty() && other.isEmpty())) {
+            const Snapshot *snapshot = other.acquire();
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            publish(snapshot);
+        }
+        return *this;
+    }
+
+    /** Test whether the list is empty. */
     bool isEmpty() const {
-        return callbacks_.empty();
+        return current_.load(std::memory_order_acquire) == nullptr;
     }
 
-    bool operator==(const Callbacks &other) {
-        return callbacks_.size() == other.callbacks_.size() &&
-            std::equal(callbacks_.begin(), callbacks_.end(), other.callbacks_.begin());
+    /** Number of callbacks in the list. */
+    size_t size() const {
+        if (isEmpty())
+            return 0;
+        ReadGuard guard(*this);
+        const Snapshot *snapshot = current_.load();
+        return snapshot ? snapshot->callbacks.size() : 0;
     }
 
+    /** Test whether two lists have equal callbacks in the same order. */
+    bool operator==(const Callbacks &other) const {
+        ReadGuard guard(*this), otherGuard(other);
+        const Snapshot *a = current_.load();
+        const Snapshot *b = other.current_.load();
+        if (a == b)
+            return true;
+        if (!a || !b)
+            return false;
+        return a->callbacks == b->callbacks;
+    }
+
+    /** Add callbacks to the end of the list.
+     *
+     * @{ */
     Callbacks& append(const Callback &callback) {
-        callbacks_.push_back(callback);
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        CbList list = copyList();
+        list.push_back(callback);
+        publish(list);
         return *this;
     }
 
     Callbacks& append(const Callbacks &other) {
-        callbacks_.insert(callbacks_.end(), other.callbacks_.begin(), other.callbacks_.end());
+        Reference snapshot(other.acquire());
+        if (snapshot.get()) {
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            CbList list = copyList();
+            list.insert(list.end(), snapshot.get()->callbacks.begin(), snapshot.get()->callbacks.end());
+            publish(list);
+        }
         return *this;
     }
-    
+    /** @} */
+
+    /** Add callbacks to the beginning of the list.
+     *
+     * @{ */
     Callbacks& prepend(const Callback &callback) {
-        callbacks_.push_front(callback);
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        CbList list = copyList();
+        list.insert(list.begin(), callback);
+        publish(list);
         return *this;
     }
 
-    Callback& prepend(const Callbacks &other) {
-        callbacks_.insert(callbacks_.begin(), other.callbacks_.begin(), other.callbacks_.end());
+    Callbacks& prepend(const Callbacks &other) {
+        Reference snapshot(other.acquire());
+        if (snapshot.get()) {
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            CbList list = copyList();
+            list.insert(list.begin(), snapshot.get()->callbacks.begin(), snapshot.get()->callbacks.end());
+            publish(list);
+        }
         return *this;
     }
-    
+    /** @} */
+
+    /** Erase the first occurrence of a callback. */
     Callbacks& eraseFirst(const Callback &callback) {
-        for (typename CbList::iterator iter=callbacks_.begin(); iter!=callbacks_.end(); ++iter) {
-            if (*iter == callback) {
-                callbacks_.erase(iter);
-                break;
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        if (const Snapshot *current = current_.load(std::memory_order_relaxed)) {
+            const CbList &cbs = current->callbacks;
+            typename CbList::const_iterator found = std::find(cbs.begin(), cbs.end(), callback);
+            if (found != cbs.end()) {
+                CbList list = cbs;
+                list.erase(list.begin() + (found - cbs.begin()));
+                publish(list);
             }
         }
         return *this;
     }
 
+    /** Erase the last occurrence of a callback. */
     Callbacks& eraseLast(const Callback &callback) {
-        for (typename CbList::reverse_iterator reverseIter=callbacks_.rbegin(); reverseIter!=callbacks_.rend(); ++reverseIter) {
-            if (*reverseIter == callback) {
-                typename CbList::iterator forwardIter = (++reverseIter).base();
-                callbacks_.erase(forwardIter);
-                break;
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        if (const Snapshot *current = current_.load(std::memory_order_relaxed)) {
+            const CbList &cbs = current->callbacks;
+            typename CbList::const_reverse_iterator found = std::find(cbs.rbegin(), cbs.rend(), callback);
+            if (found != cbs.rend()) {
+                CbList list = cbs;
+                list.erase(list.begin() + (cbs.rend() - found - 1));
+                publish(list);
             }
         }
         return *this;
     }
 
+    /** Erase all occurrences of a callback. */
     Callbacks& eraseMatching(const Callback &callback) {
-        typename CbList::iterator iter = callbacks_.begin();
-        while (iter!=callbacks_.end()) {
-            if (*iter == callback) {
-                typename CbList::iterator toErase = iter++;
-                callbacks_.erase(toErase);              // std::list iterators are stable over erasure
-            } else {
-                ++iter;
-            }
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        const Snapshot *current = current_.load(std::memory_order_relaxed);
+        if (current && std::find(current->callbacks.begin(), current->callbacks.end(), callback) != current->callbacks.end()) {
+            CbList list = current->callbacks;
+            list.erase(std::remove(list.begin(), list.end(), callback), list.end());
+            publish(list);
         }
+        return *this;
     }
 
     template<class CB, class Args>
@@ -87,31 +234,105 @@ public:
         return (*callback)(chained, args);
     }
 
-#if __cplusplus >= 201103ul
     template<class CB, class Args>
     bool applyCallback(const std::shared_ptr<CB> &callback, bool chained, Args &args) const {
         return (*callback)(chained, args);
     }
-#endif
 
     template<class CB, class Args>
     bool applyCallback(CB &callback, bool chained, Args &args) const {
         return callback(chained, args);
     }
 
+    /** Invoke each callback in order.
+     *
+     *  Each callback is called with the return value of the previous callback (or @p chained for the first callback) and the
+     *  arguments, and the return value of the last callback is returned. The callbacks are those of the snapshot that was
+     *  current when this method started, which remains valid until this method returns even if the list is modified.
+     *
+     * @{ */
     template<class Arguments>
     bool apply(bool chained, const Arguments &arguments) const {
-        for (typename CbList::const_iterator iter=callbacks_.begin(); iter!=callbacks_.end(); ++iter)
-            chained = applyCallback(*iter, chained, arguments);
+        if (current_.load(std::memory_order_relaxed)) {
+            ReadGuard guard(*this);
+            if (const Snapshot *snapshot = current_.load()) {
+                const CbList &cbs = snapshot->callbacks;
+                for (typename CbList::const_iterator iter = cbs.begin(); iter != cbs.end(); ++iter)
+                    chained = applyCallback(*iter, chained, arguments);
+            }
+        }
         return chained;
     }
 
     template<class Arguments>
     bool apply(bool chained, Arguments &arguments) const {
-        for (typename CbList::const_iterator iter=callbacks_.begin(); iter!=callbacks_.end(); ++iter)
-            chained = applyCallback(*iter, chained, arguments);
+        if (current_.load(std::memory_order_relaxed)) {
+            ReadGuard guard(*this);
+            if (const Snapshot *snapshot = current_.load()) {
+                const CbList &cbs = snapshot->callbacks;
+                for (typename CbList::const_iterator iter = cbs.begin(); iter != cbs.end(); ++iter)
+                    chained = applyCallback(*iter, chained, arguments);
+            }
+        }
         return chained;
     }
+    /** @} */
+
+private:
+    // Drop a reference to a snapshot, freeing it if it was the last.
+    static void release(const Snapshot *snapshot) {
+        if (snapshot && 1 == snapshot->nRefs.fetch_sub(1, std::memory_order_acq_rel))
+            delete snapshot;
+    }
+
+    // A new reference to the current snapshot, or null if the list is empty. Safe to call without holding the lock.
+    const Snapshot* acquire() const {
+        if (isEmpty())
+            return nullptr;
+        ReadGuard guard(*this);
+        const Snapshot *snapshot = current_.load();
+        if (snapshot)
+            snapshot->nRefs.fetch_add(1, std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    // Copy of the current list of callbacks. The caller must hold the lock.
+    CbList copyList() const {
+        const Snapshot *current = current_.load(std::memory_order_relaxed);
+        return current ? current->callbacks : CbList();
+    }
+
+    // Make the specified list current. The caller must hold the lock.
+    void publish(const CbList &list) {
+        publish(list.empty() ? nullptr : new Snapshot(list));
+    }
+
+    // Make the specified snapshot current, taking over the caller's reference to it. The old snapshot is retired because
+    // applications that loaded it before this store might still be using it. The caller must hold the lock.
+    void publish(const Snapshot *snapshot) {
+        if (const Snapshot *old = current_.exchange(snapshot)) {
+            retired_.push_back(old);
+            hasRetired_.store(true);
+        }
+        reclaimNS();
+    }
+
+    // Free retired snapshots if no application is in progress. An application that starts after the count is read loads the
+    // current snapshot, which is never retired. These orderings are sequentially consistent with the increments and decrements
+    // of nReaders_, so either this function or the last reader to finish sees the other's change.
+    void reclaimNS() const {
+        if (!retired_.empty() && 0 == nReaders_.load()) {
+            for (const Snapshot *snapshot: retired_)
+                release(snapshot);
+            retired_.clear();
+            hasRetired_.store(false);
+        }
+    }
+
+    void reclaim() const {
+        SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+        reclaimNS();
+    }
 };
 
 template<class Callback>
@@ -161,6 +161,7 @@ class Switch;
 class SwitchGroup;
 class Parser;
 class ParserResult;
+class ParserIndex;
 
 /** The order in which things are sorted in the documentation. */
 enum SortOrder {
@@ -401,7 +402,7 @@ public:
     typedef SharedPointer<TypedSaver> Ptr;
     static Ptr instance(T &storage) { return Ptr(new TypedSaver(storage)); }
     virtual void save(const boost::any &value, const std::string &/*switchKey*/) /*override*/ {
-        storage_ = boost::any_cast<T>(value);
+        storage_ = boost::any_cast<const T&>(value);
     }
 };
 
@@ -417,7 +418,7 @@ public:
     public:                                                                                                                    \
         static Ptr instance(CONTAINER_TEMPLATE<T> &storage) { return Ptr(new TypedSaver(storage)); }                           \
         virtual void save(const boost::any &value, const std::string &/*switchKey*/) /*override*/ {                            \
-            T typed = boost::any_cast<T>(value);                                                                               \
+            const T &typed = boost::any_cast<const T&>(value);                                                                 \
             storage_.INSERT_METHOD(typed);                                                                                     \
         }                                                                                                                      \
     }
@@ -435,7 +436,7 @@ public:
     public:                                                                                                                    \
         static Ptr instance(CONTAINER_TEMPLATE<std::string, T> &storage) { return Ptr(new TypedSaver(storage)); }              \
         virtual void save(const boost::any &value, const std::string &switchKey) /*override*/ {                                \
-            T typed = boost::any_cast<T>(value);                                                                               \
+            const T &typed = boost::any_cast<const T&>(value);                                                                 \
             storage_.INSERT_METHOD(switchKey, typed);                                                                          \
         }                                                                                                                      \
     }
@@ -452,7 +453,7 @@ public:
     public:                                                                                                                    \
         static Ptr instance(CONTAINER_TEMPLATE<Interval> &storage) { return Ptr(new TypedSaver(storage)); }                    \
         virtual void save(const boost::any &value, const std::string &/*switchKey*/) /*override*/ {                            \
-            Interval typed = boost::any_cast<Interval>(value);                                                                        \
+            const Interval &typed = boost::any_cast<const Interval&>(value);                                                          \
             storage_.INSERT_METHOD(typed);                                                                                     \
         }                                                                                                                      \
     }
@@ -470,7 +471,7 @@ public:
     public:                                                                                                                    \
         static Ptr instance(CONTAINER_TEMPLATE<std::string, T> &storage) { return Ptr(new TypedSaver(storage)); }              \
         virtual void save(const boost::any &value, const std::string &switchKey) /*override*/ {                                \
-            T typed = boost::any_cast<T>(value);                                                                               \
+            const T &typed = boost::any_cast<const T&>(value);                                                                 \
             storage_.INSERT_METHOD(std::make_pair(switchKey, typed));                                                          \
         }                                                                                                                      \
     }
@@ -2747,6 +2748,20 @@ typedef Container::Map<std::string, GroupedSwitches> NamedSwitches;
  *  is then applied to a program command line to return a ParserResult. The process of parsing a command line is free of
  *  side-effects other than creating the result. */
 class SAWYER_EXPORT Parser {
+    // Owns the lookup tables that parsing builds from the switch declarations. The tables point into the parser's own switch
+    // groups, therefore copying a parser doesn't copy its tables.
+    class SAWYER_EXPORT IndexCache {
+        ParserIndex *index_;
+    public:
+        IndexCache(): index_(NULL) {}
+        IndexCache(const IndexCache&): index_(NULL) {}
+        IndexCache& operator=(const IndexCache&) { clear(); return *this; }
+        ~IndexCache();
+        ParserIndex* get() const { return index_; }
+        void set(ParserIndex*);
+        void clear();
+    };
+
 #include <Sawyer/WarningsOff.h>
     std::vector<SwitchGroup> switchGroups_;             /**< Declarations for all recognized switches. */
     ParsingProperties properties_;                      /**< Some properties inherited by switch groups and switches. */
@@ -2770,6 +2785,7 @@ class SAWYER_EXPORT Parser {
     SortOrder switchGroupOrder_;                        /**< Order of switch groups in the documentation. */
     bool reportingAmbiguities_;                         /**< Whether to report ambiguous switches. */
     std::string environmentVariable_;                   /**< parse() reads from this variable first. */
+    IndexCache indexCache_;                             /**< Switch lookup tables, built when needed. */
 #include <Sawyer/WarningsRestore.h>
 
 public:
@@ -2787,35 +2803,45 @@ public:
      * @{ */
     Parser& with(const SwitchGroup &sg) {
         switchGroups_.push_back(sg);
+        indexCache_.clear();
         return *this;
     }
     Parser& with(const SwitchGroup &sg, const std::string &docKey) {
         switchGroups_.push_back(sg);
         switchGroups_.back().docKey(docKey);
+        indexCache_.clear();
         return *this;
     }
     Parser& with(const std::vector<SwitchGroup> &sgs) {
         switchGroups_.insert(switchGroups_.end(), sgs.begin(), sgs.end());
+        indexCache_.clear();
         return *this;
     }
     Parser& with(const Switch &sw) {
         switchGroups_.push_back(SwitchGroup().insert(sw));
+        indexCache_.clear();
         return *this;
     }
     Parser& with(Switch sw, const std::string &docKey) {
         sw.docKey(docKey);
         switchGroups_.push_back(SwitchGroup().insert(sw));
+        indexCache_.clear();
         return *this;
     }
     /** @} */
 
     /** List of all switch groups.
+     *
+     *  The parser reuses lookup tables built from its switch groups from one parse to the next. The non-const version discards
+     *  them so that changes made through the returned reference are seen by the next parse; the reference should not be used
+     *  to modify the switch groups after that.
      *
      * @{ */
     const std::vector<SwitchGroup>& switchGroups() const {
         return switchGroups_;
     }
     std::vector<SwitchGroup>& switchGroups() {
+        indexCache_.clear();
         return switchGroups_;
     }
     /** @} */
@@ -2864,7 +2890,7 @@ public:
      *
      * @{ */
     const std::string& groupNameSeparator() const { return groupNameSeparator_; }
-    Parser& groupNameSeparator(const std::string &s) { groupNameSeparator_ = s; return *this; }
+    Parser& groupNameSeparator(const std::string &s) { groupNameSeparator_ = s; indexCache_.clear(); return *this; }
     /** @} */
 
     /** Property: How to show group names in switch documentation.
@@ -2877,7 +2903,7 @@ public:
      *
      * @{ */
     ShowGroupName showingGroupNames() const { return properties_.showGroupName; }
-    Parser& showingGroupNames(ShowGroupName x) { properties_.showGroupName = x; return *this; }
+    Parser& showingGroupNames(ShowGroupName x) { properties_.showGroupName = x; indexCache_.clear(); return *this; }
     /** @} */
 
     /** Prefixes to use for long command-line switches.  The @ref resetLongPrefixes clears the list (and adds prefixes) while
@@ -2886,7 +2912,11 @@ public:
      * @{ */
     Parser& resetLongPrefixes(const std::string &s1=STR_NONE, const std::string &s2=STR_NONE,
                               const std::string &s3=STR_NONE, const std::string &s4=STR_NONE);
-    Parser& longPrefix(const std::string &s1) { properties_.longPrefixes.push_back(s1); return *this; }
+    Parser& longPrefix(const std::string &s1) {
+        properties_.longPrefixes.push_back(s1);
+        indexCache_.clear();
+        return *this;
+    }
     const std::vector<std::string>& longPrefixes() const { return properties_.longPrefixes; }
     /** @} */
 
@@ -2896,7 +2926,11 @@ public:
      * @{ */
     Parser& resetShortPrefixes(const std::string &s1=STR_NONE, const std::string &s2=STR_NONE,
                                const std::string &s3=STR_NONE, const std::string &s4=STR_NONE);
-    Parser& shortPrefix(const std::string &s1) { properties_.shortPrefixes.push_back(s1); return *this; }
+    Parser& shortPrefix(const std::string &s1) {
+        properties_.shortPrefixes.push_back(s1);
+        indexCache_.clear();
+        return *this;
+    }
     const std::vector<std::string>& shortPrefixes() const { return properties_.shortPrefixes; }
     /** @} */
 
@@ -2908,7 +2942,11 @@ public:
      * @{ */
     Parser& resetValueSeparators(const std::string &s1=STR_NONE, const std::string &s2=STR_NONE,
                                 const std::string &s3=STR_NONE, const std::string &s4=STR_NONE);
-    Parser& valueSeparator(const std::string &s1) { properties_.valueSeparators.push_back(s1); return *this; }
+    Parser& valueSeparator(const std::string &s1) {
+        properties_.valueSeparators.push_back(s1);
+        indexCache_.clear();
+        return *this;
+    }
     const std::vector<std::string>& valueSeparators() const { return properties_.valueSeparators; }
     /** @} */
 
@@ -3185,6 +3223,7 @@ public:
         initDocGrammar(grammar);
         grammar.title(programName(), boost::lexical_cast<std::string>(chapter().first), chapter().second);
         grammar.version(version().first, version().second);
+        grammar.cacheKey(docCacheKey());
         grammar.emit(documentationMarkup());
     }
 
@@ -3253,20 +3292,26 @@ private:
     // Implementation for the public parse methods.
     ParserResult parseInternal(std::vector<std::string> programArguments);
 
+    // Lookup tables for the switch declarations, built if necessary.
+    ParserIndex& index();
+
     // Parse one switch from the current position in the command line and return the switch descriptor.  If the cursor is at
     // the end of the command line then return false without updating the cursor or parsed values.  If the cursor is at a
     // termination switch (e.g., "--") then consume the terminator and return false.  If the switch name is valid but the
     // arguments cannot be parsed, then throw an error.  If the cursor is at what appears to be a switch but no matching switch
     // declaration can be found, then throw an error.  The cursor will not be modified when an error is thrown.
-    bool parseOneSwitch(Cursor&, const NamedSwitches &ambiguities, ParserResult&/*out*/);
+    bool parseOneSwitch(Cursor&, const ParserIndex&, const NamedSwitches &ambiguities, ParserResult&/*out*/);
 
     /** Parse one long switch.  Upon entry, the cursor should be positioned at the beginning of a program argument. On success,
      *  the cursor will be positioned at the beginning of a subsequent program argument, or at the end of input.  If a switch
      *  is successfully parsed, a pointer to the switch is returned and values are appended to @p parsedValues (the returned
      *  pointer is valid only as long as this parser is allocated). If no switch is available for parsing then the null pointer
      *  is returned. If some other parsing error occurs then a null value is returned and the @p saved_error is updated to
-     *  reflect the nature of the error.  This function does not throw <code>std::runtime_error</code> exceptions. */
-    const Switch* parseLongSwitch(Cursor&, ParsedValues&, const NamedSwitches &ambiguities, Optional<std::runtime_error>&);
+     *  reflect the nature of the error.  This function does not throw <code>std::runtime_error</code> exceptions.
+     *
+     *  Only those switches that the @p index reports as candidates for the current program argument are tried. */
+    const Switch* parseLongSwitch(Cursor&, const ParserIndex&, ParsedValues&, const NamedSwitches &ambiguities,
+                                  Optional<std::runtime_error>&);
 
     /** Parse one short switch.  Upon entry, the cursor is either at the beginning of a program argument, or at the beginning
      *  of a (potential) short switch name. On success, for non-nestled switches the cursor will be positioned at the beginning
@@ -3275,14 +3320,12 @@ private:
      *  appended to @p parsedValues (the returned pointer is valid only as long as this parser is allocated). If no switch is
      *  available for parsing then the null pointer is returned. If some other parsing error occurs then a null value is
      *  returned and the @p saved_error is updated to reflect the nature of the error.  This function does not throw
-     *  <code>std::runtime_error</code> exceptions. */
-    const Switch* parseShortSwitch(Cursor&, ParsedValues&, const NamedSwitches &ambiguities,
+     *  <code>std::runtime_error</code> exceptions.
+     *
+     *  Only those switches that the @p index reports as candidates for the current cursor position are tried. */
+    const Switch* parseShortSwitch(Cursor&, const ParserIndex&, ParsedValues&, const NamedSwitches &ambiguities,
                                    Optional<std::runtime_error>&, bool mayNestle);
 
-    // Returns true if the program argument at the cursor looks like it might be a switch.  Apparent switches are any program
-    // argument that starts with a long or short prefix.
-    bool apparentSwitch(const Cursor&) const;
-
     // Returns the best prefix for each switch--the one used for documentation
     void preferredSwitchPrefixes(Container::Map<std::string, std::string> &prefixMap /*out*/) const;
 
@@ -3296,6 +3339,10 @@ private:
     // Document::PodMarkup.
     void initDocGrammar(Document::Markup::Grammar& /*in,out*/) const;
 
+    // Key for the Document::RenderCache describing everything besides the documentation markup that affects how the
+    // documentation renders, namely the properties and switch names used by the functions that initDocGrammar registers.
+    std::string docCacheKey() const;
+
     // FIXME[Robb Matzke 2014-02-21]: Some way to parse command-lines from a config file, or to merge parsed command-lines with
     // a yaml config file, etc.
 };
@@ -3444,9 +3491,10 @@ public:
     const Parser& parser() const { return parser_; }
 
 private:
-    // Insert more parsed values.  Values should be inserted one switch's worth at a time (or fewer)
-    void insertValuesForSwitch(const ParsedValues&, const Parser*, const Switch*);
-    void insertOneValue(const ParsedValue&, const Switch*, bool save=true);
+    // Insert more parsed values.  Values should be inserted one switch's worth at a time (or fewer). The values are moved
+    // into this result, leaving the arguments in a valid but unspecified state.
+    void insertValuesForSwitch(ParsedValues&, const Parser*, const Switch*);
+    void insertOneValue(ParsedValue&, const Switch*, bool save=true);
 
     // Indicate that we're skipping over a program argument
     void skip(const Location&);
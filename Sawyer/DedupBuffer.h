@@ -0,0 +1,450 @@
+#ifndef Sawyer_DedupBuffer_H
+#define Sawyer_DedupBuffer_H
+
+#include <Sawyer/Assert.h>
+#include <Sawyer/Buffer.h>
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/SharedObject.h>
+#include <Sawyer/SharedPointer.h>
+#include <Sawyer/Synchronization.h>
+
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/array.hpp>
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/unordered_map.hpp>
+#include <cstring>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+
+/** Stores pages of data by content.
+ *
+ *  Memory images and core dumps are mostly pages of zeros and pages whose contents are repeated, either within one image or
+ *  across several similar images. This buffer divides its data into fixed-size pages. Pages of zeros are not stored at all,
+ *  and pages with identical content are stored once and shared, not only within this buffer but among all buffers that use
+ *  the same @ref Pool. Shared pages are copied when they're written (this is unrelated to the buffer's @ref
+ *  Buffer::copyOnWrite "copyOnWrite" property, which is used by @ref AddressMap).
+ *
+ *  A write that covers a whole page looks up the page's new content in the pool, so loading data in large writes deduplicates
+ *  it as it's loaded. A write that covers only part of a page makes a private copy of the page and modifies it; the private
+ *  copies are deduplicated by calling @ref deduplicate.
+ *
+ *  This buffer has no contiguous data, so @ref data returns a null pointer. Values are copied with @c memcpy and pages of
+ *  zeros read as values whose bytes are all zero, so the value type must be trivially copyable.
+ *
+ *  The following example loads several similar firmware images into maps whose buffers share one pool:
+ *
+ * @code
+ *  typedef DedupBuffer<rose_addr_t, uint8_t> Buffer;
+ *  Buffer::Pool::Ptr pool = Buffer::Pool::instance();
+ *  for (const std::vector<uint8_t> &image: images) {
+ *      Buffer::Super::Ptr buffer = Buffer::instance(image.size(), pool);
+ *      buffer->write(image.data(), 0, image.size());
+ *      maps.push_back(MemoryMap());
+ *      maps.back().insert(AddressInterval::baseSize(base, image.size()), Segment(buffer, 0, Access::READABLE));
+ *  }
+ *  std::cout <<"stored " <<pool->nBytes() <<" bytes for " <<images.size() <<" images\n";
+ * @endcode
+ *
+ *  A buffer, like other buffers, must not be modified concurrently by multiple threads, but buffers that share a pool may be
+ *  used concurrently. */
+template<class A, class T>
+class DedupBuffer: public Buffer<A, T> {
+public:
+    typedef A Address;                                  /**< Type of addresses. */
+    typedef T Value;                                    /**< Type of values. */
+    typedef Buffer<A, T> Super;                         /**< Type of base class. */
+
+private:
+    // A page of values. Interned pages belong to a pool and are never modified; other pages are private to one buffer until
+    // the buffer is copied.
+    class Page: public SharedObject {
+    public:
+        std::vector<Value> values;
+        boost::uint64_t hash;
+        bool interned;
+
+        explicit Page(size_t n)
+            : values(n), hash(0), interned(false) {}
+    };
+
+    typedef SharedPointer<Page> PagePtr;
+
+public:
+    /** Set of pages shared by buffers.
+     *
+     *  A pool holds one copy of each distinct non-zero page written to any of its buffers, and discards a page when no buffer
+     *  references it any longer. All buffers that use a pool have the pool's page size. Pools are thread safe. */
+    class Pool: public SharedObject {
+    public:
+        /** Reference counting pointer. */
+        typedef SharedPointer<Pool> Ptr;
+
+    private:
+        typedef boost::unordered_multimap<boost::uint64_t, PagePtr> Pages;
+
+        mutable SAWYER_THREAD_TRAITS::Mutex mutex_;     // protects the following data members
+        size_t pageSize_;
+        Pages pages_;
+
+    protected:
+        explicit Pool(size_t pageSize)
+            : pageSize_(pageSize) {
+            ASSERT_require(pageSize > 0);
+        }
+
+    public:
+        /** Allocating constructor.
+         *
+         *  Creates an empty pool whose pages hold @p pageSize values each. */
+        static Ptr instance(size_t pageSize = 4096) {
+            return Ptr(new Pool(pageSize));
+        }
+
+        /** Number of values per page. */
+        size_t pageSize() const {
+            return pageSize_;
+        }
+
+        /** Number of distinct pages stored.
+         *
+         *  Pages of zeros are not stored. */
+        size_t nPages() const {
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            return pages_.size();
+        }
+
+        /** Number of bytes of data stored.
+         *
+         *  This is the size of the stored pages' values, not counting the per-page overhead. */
+        size_t nBytes() const {
+            return nPages() * pageSize_ * sizeof(Value);
+        }
+
+    private:
+        friend class DedupBuffer;
+
+        // Returns the pooled page having the specified values, adding it to the pool if necessary. Returns the null pointer for
+        // a page of zeros.
+        PagePtr intern(const Value *values) {
+            if (isZero(values, pageSize_))
+                return PagePtr();
+            const boost::uint64_t hash = hashValues(values, pageSize_);
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            if (PagePtr found = findNS(values, hash))
+                return found;
+            PagePtr page(new Page(pageSize_));
+            memcpy(&page->values[0], values, pageSize_ * sizeof(Value));
+            page->hash = hash;
+            page->interned = true;
+            pages_.insert(std::make_pair(hash, page));
+            return page;
+        }
+
+        // Same as intern except the argument is a private page that becomes the pooled page if its content is new.
+        PagePtr adopt(const PagePtr &page) {
+            ASSERT_not_null(page);
+            ASSERT_forbid(page->interned);
+            if (isZero(&page->values[0], pageSize_))
+                return PagePtr();
+            const boost::uint64_t hash = hashValues(&page->values[0], pageSize_);
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);
+            if (PagePtr found = findNS(&page->values[0], hash))
+                return found;
+            page->hash = hash;
+            page->interned = true;
+            pages_.insert(std::make_pair(hash, page));
+            return page;
+        }
+
+        // Drops the caller's reference to a page, and removes the page from the pool if the pool then has the only reference.
+        void release(PagePtr &page) {
+            if (!page || !page->interned) {
+                page = PagePtr();
+                return;
+            }
+            SAWYER_THREAD_TRAITS::LockGuard lock(mutex_);  // the reference must be dropped while locked
+            if (ownershipCount(page) == 2) {            // the pool's and the caller's
+                std::pair<typename Pages::iterator, typename Pages::iterator> range = pages_.equal_range(page->hash);
+                for (typename Pages::iterator iter = range.first; iter != range.second; ++iter) {
+                    if (iter->second == page) {
+                        pages_.erase(iter);
+                        break;
+                    }
+                }
+            }
+            page = PagePtr();
+        }
+
+        PagePtr findNS(const Value *values, boost::uint64_t hash) const {
+            std::pair<typename Pages::const_iterator, typename Pages::const_iterator> range = pages_.equal_range(hash);
+            for (typename Pages::const_iterator iter = range.first; iter != range.second; ++iter) {
+                if (0 == memcmp(&iter->second->values[0], values, pageSize_ * sizeof(Value)))
+                    return iter->second;
+            }
+            return PagePtr();
+        }
+    };
+
+private:
+    typename Pool::Ptr pool_;
+    Address size_;
+    std::vector<PagePtr> pages_;                        // null pointers are pages of zeros
+
+private:
+    friend class boost::serialization::access;
+
+    // Users: You'll need to register the subclass once you know its type, such as
+    // BOOST_CLASS_REGISTER(Sawyer::Container::DedupBuffer<size_t,uint8_t>);
+    template<class S>
+    void save(S &s, const unsigned /*version*/) const {
+        s & BOOST_SERIALIZATION_BASE_OBJECT_NVP(Super);
+        size_t pageSize = pool_->pageSize();
+        s & BOOST_SERIALIZATION_NVP(pageSize);
+        s & BOOST_SERIALIZATION_NVP(size_);
+        for (size_t i = 0; i < pages_.size(); ++i) {
+            bool isZeroPage = !pages_[i];
+            s & BOOST_SERIALIZATION_NVP(isZeroPage);
+            if (!isZeroPage)
+                s & boost::serialization::make_nvp("page", boost::serialization::make_array(&pages_[i]->values[0], pageSize));
+        }
+    }
+
+    template<class S>
+    void load(S &s, const unsigned /*version*/) {
+        s & BOOST_SERIALIZATION_BASE_OBJECT_NVP(Super);
+        size_t pageSize = 0;
+        s & BOOST_SERIALIZATION_NVP(pageSize);
+        s & BOOST_SERIALIZATION_NVP(size_);
+        releaseAll();
+        pool_ = Pool::instance(pageSize);
+        pages_.resize(nPagesFor(size_));
+        std::vector<Value> page(pageSize);
+        for (size_t i = 0; i < pages_.size(); ++i) {
+            bool isZeroPage = false;
+            s & BOOST_SERIALIZATION_NVP(isZeroPage);
+            if (!isZeroPage) {
+                s & boost::serialization::make_nvp("page", boost::serialization::make_array(&page[0], pageSize));
+                pages_[i] = pool_->intern(&page[0]);
+            }
+        }
+    }
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    // For serialization only
+    DedupBuffer()
+        : pool_(Pool::instance()), size_(0) {}
+
+protected:
+    DedupBuffer(Address size, const typename Pool::Ptr &pool)
+        : Super(".DedupBuffer"), pool_(pool), size_(0) {
+        ASSERT_not_null(pool);
+        resize(size);
+    }
+
+    DedupBuffer(const DedupBuffer &other)
+        : Super(".DedupBuffer"), pool_(other.pool_), size_(other.size_), pages_(other.pages_) {}
+
+public:
+    ~DedupBuffer() {
+        releaseAll();
+    }
+
+    /** Allocating constructor.
+     *
+     *  Creates a buffer of @p size values which are initially zero. The buffer's pages are shared with other buffers that use
+     *  the same @p pool, or with no other buffers if a pool is not specified. */
+    static typename Buffer<A, T>::Ptr instance(Address size, const typename Pool::Ptr &pool = Pool::instance()) {
+        return typename Buffer<A, T>::Ptr(new DedupBuffer(size, pool));
+    }
+
+    /** Pool that stores this buffer's pages. */
+    typename Pool::Ptr pool() const {
+        return pool_;
+    }
+
+    /** Create a new copy of buffer data.
+     *
+     *  The copy shares all its pages with this buffer, so copying is fast and uses little memory. */
+    typename Buffer<A, T>::Ptr copy() const /*override*/ {
+        return typename Buffer<A, T>::Ptr(new DedupBuffer(*this));
+    }
+
+    Address available(Address start) const /*override*/ {
+        return start < size_ ? size_ - start : 0;
+    }
+
+    void resize(Address newSize) /*override*/ {
+        const size_t pageSize = pool_->pageSize();
+        if (newSize < size_ && newSize % pageSize != 0 && pages_[newSize / pageSize]) {
+            // Values beyond the new end of the last page must be zero in case the buffer grows again. A page of zeros already
+            // is, and stays unstored.
+            std::vector<Value> zeros(pageSize - newSize % pageSize);
+            zeroFill(&zeros[0], zeros.size());
+            write(&zeros[0], newSize, zeros.size());
+        }
+        for (size_t i = nPagesFor(newSize); i < pages_.size(); ++i)
+            pool_->release(pages_[i]);
+        pages_.resize(nPagesFor(newSize));
+        size_ = newSize;
+    }
+
+    Address read(Value *buf, Address address, Address n) const /*override*/ {
+        n = std::min(n, available(address));
+        if (buf) {
+            const size_t pageSize = pool_->pageSize();
+            for (Address i = 0; i < n; /*void*/) {
+                const size_t pageIdx = (address + i) / pageSize;
+                const size_t offset = (address + i) % pageSize;
+                const size_t nHere = std::min(pageSize - offset, size_t(n - i));
+                if (const PagePtr &page = pages_[pageIdx]) {
+                    memcpy(buf + i, &page->values[offset], nHere * sizeof(Value));
+                } else {
+                    zeroFill(buf + i, nHere);
+                }
+                i += nHere;
+            }
+        }
+        return n;
+    }
+
+    Address write(const Value *buf, Address address, Address n) /*override*/ {
+        n = std::min(n, available(address));
+        if (buf) {
+            const size_t pageSize = pool_->pageSize();
+            for (Address i = 0; i < n; /*void*/) {
+                const size_t pageIdx = (address + i) / pageSize;
+                const size_t offset = (address + i) % pageSize;
+                const size_t nHere = std::min(pageSize - offset, size_t(n - i));
+                if (nHere == pageSize) {
+                    PagePtr page = pool_->intern(buf + i);
+                    std::swap(page, pages_[pageIdx]);
+                    pool_->release(page);
+                } else {
+                    memcpy(&writablePage(pageIdx)->values[offset], buf + i, nHere * sizeof(Value));
+                }
+                i += nHere;
+            }
+        }
+        return n;
+    }
+
+    const Value* data() const /*override*/ {
+        return NULL;
+    }
+
+    /** Share pages that were partly written.
+     *
+     *  Pages that were modified by writes that didn't cover the whole page are private to this buffer. This function moves
+     *  them into the pool, discarding pages of zeros and pages whose content is already in the pool. */
+    void deduplicate() {
+        for (size_t i = 0; i < pages_.size(); ++i) {
+            if (pages_[i] && !pages_[i]->interned) {
+                // A private page that's shared with a copy of this buffer is interned by value so the copy isn't affected.
+                PagePtr page = ownershipCount(pages_[i]) == 1 ? pool_->adopt(pages_[i]) : pool_->intern(&pages_[i]->values[0]);
+                std::swap(page, pages_[i]);
+                pool_->release(page);
+            }
+        }
+    }
+
+    /** Number of pages.
+     *
+     *  This is the number of pages needed to hold the values in this buffer, whether they're stored or not. */
+    size_t nPages() const {
+        return pages_.size();
+    }
+
+    /** Number of pages of zeros.
+     *
+     *  Pages of zeros are not stored. */
+    size_t nZeroPages() const {
+        return std::count(pages_.begin(), pages_.end(), PagePtr());
+    }
+
+    /** Number of pages stored.
+     *
+     *  This is the number of distinct stored pages referenced by this buffer, including pages that are also referenced by
+     *  other buffers that use the same pool. */
+    size_t nStoredPages() const {
+        std::vector<const Page*> stored;
+        stored.reserve(pages_.size());
+        for (const PagePtr &page: pages_) {
+            if (page)
+                stored.push_back(page.getRawPointer());
+        }
+        std::sort(stored.begin(), stored.end());
+        return std::unique(stored.begin(), stored.end()) - stored.begin();
+    }
+
+    /** Deduplication ratio.
+     *
+     *  The number of pages in this buffer divided by the number of pages stored for it. A buffer that stores no pages is
+     *  treated as storing one so that the ratio is finite. */
+    double dedupRatio() const {
+        return (double)nPages() / std::max(nStoredPages(), size_t(1));
+    }
+
+private:
+    size_t nPagesFor(Address size) const {
+        return size / pool_->pageSize() + (size % pool_->pageSize() != 0 ? 1 : 0);
+    }
+
+    // Returns a page that this buffer can modify, copying a shared page or allocating a page of zeros if necessary.
+    const PagePtr& writablePage(size_t pageIdx) {
+        PagePtr &page = pages_[pageIdx];
+        if (!page) {
+            page = PagePtr(new Page(pool_->pageSize()));
+            zeroFill(&page->values[0], page->values.size());
+        } else if (page->interned || ownershipCount(page) > 1) {
+            PagePtr copy(new Page(pool_->pageSize()));
+            copy->values = page->values;
+            std::swap(copy, page);
+            pool_->release(copy);
+        }
+        return page;
+    }
+
+    void releaseAll() {
+        for (PagePtr &page: pages_)
+            pool_->release(page);
+        pages_.clear();
+    }
+
+    static void zeroFill(Value *values, size_t n) {
+        memset(values, 0, n * sizeof(Value));
+    }
+
+    static bool isZero(const Value *values, size_t n) {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char*>(values);
+        const size_t nBytes = n * sizeof(Value);
+        return nBytes == 0 || (bytes[0] == 0 && 0 == memcmp(bytes, bytes + 1, nBytes - 1));
+    }
+
+    // 64-bit FNV-1a over the bytes of the values, a word at a time.
+    static boost::uint64_t hashValues(const Value *values, size_t n) {
+        const unsigned char *bytes = reinterpret_cast<const unsigned char*>(values);
+        const size_t nBytes = n * sizeof(Value);
+        boost::uint64_t hash = 0xcbf29ce484222325ull;
+        size_t i = 0;
+        for (/*void*/; i + 8 <= nBytes; i += 8) {
+            boost::uint64_t word;
+            memcpy(&word, bytes + i, 8);
+            hash = (hash ^ word) * 0x100000001b3ull;
+        }
+        for (/*void*/; i < nBytes; ++i)
+            hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+        return hash ^ (hash >> 32);
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
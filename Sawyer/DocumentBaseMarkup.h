@@ -2,11 +2,81 @@
 #define Sawyer_Document_BaseMarkup_H
 
 #include <Sawyer/DocumentMarkup.h>
+#include <Sawyer/Map.h>
+#include <Sawyer/Optional.h>
 #include <Sawyer/Sawyer.h>
+#include <Sawyer/Synchronization.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
 
 namespace Sawyer {
 namespace Document {
 
+/** Cache of rendered documents.
+ *
+ *  Rendering a large document, such as a manual page for a tool with many switches, is expensive compared to looking it up,
+ *  so markup grammars can save their output here and reuse it the next time the same document is rendered. Entries are keyed
+ *  by a string that must contain everything that affects the rendered output, and are found by a hash of that string. The
+ *  full key is stored with each entry and compared on lookup, so hash collisions cannot return the wrong document.
+ *
+ *  Entries are always held in memory for the life of the process. If a directory is set, either with @ref directory or with
+ *  the @c SAWYER_DOC_CACHE environment variable, then entries are also written to files in that directory so that later
+ *  invocations of the program can use them.  Failure to read or write these files is not an error; the document is simply
+ *  rendered again.
+ *
+ *  This class is thread safe. */
+class SAWYER_EXPORT RenderCache {
+    typedef std::pair<std::string /*key*/, std::string /*rendered*/> Entry;
+    typedef Container::Map<boost::uint64_t, Entry> Entries;
+
+    mutable SAWYER_THREAD_TRAITS::Mutex mutex_;         // protects all following data members
+    Entries entries_;                                   // entries indexed by hash of key
+    boost::filesystem::path directory_;                 // optional directory for persistent entries
+
+    RenderCache();
+
+public:
+    /** The cache used by the whole process. */
+    static RenderCache& instance();
+
+    /** Hash for a key. */
+    static boost::uint64_t hash(const std::string &key);
+
+    /** Find a rendered document.
+     *
+     *  Returns the rendered document previously inserted with the same key, or nothing. */
+    Optional<std::string> find(const std::string &key);
+
+    /** Insert a rendered document.
+     *
+     *  Replaces any document previously inserted with the same key. */
+    void insert(const std::string &key, const std::string &rendered);
+
+    /** Remove all entries from memory.
+     *
+     *  Files in the cache directory are not removed. */
+    void clear();
+
+    /** Number of entries held in memory. */
+    size_t size() const;
+
+    /** Property: Directory for persistent entries.
+     *
+     *  An empty path disables persistent entries. The default is the value of the @c SAWYER_DOC_CACHE environment variable, if
+     *  set. The directory is created if necessary when the first entry is written.
+     *
+     * @{ */
+    boost::filesystem::path directory() const;
+    void directory(const boost::filesystem::path&);
+    /** @} */
+
+private:
+    boost::filesystem::path fileName(boost::uint64_t hash) const;
+    Optional<std::string> readFile(boost::uint64_t hash, const std::string &key) const;
+    void writeFile(boost::uint64_t hash, const std::string &key, const std::string &rendered) const;
+};
+
 /** Base class for various documentation markup systems. */
 class SAWYER_EXPORT BaseMarkup: public Markup::Grammar {
     std::string pageName_;                              // name of document page, usually one word
@@ -14,6 +84,7 @@ class SAWYER_EXPORT BaseMarkup: public Markup::Grammar {
     std::string chapterTitle_;                          // like "Command-line tools"
     std::string versionStr_;                            // version string
     std::string versionDate_;                           // date string
+    std::string cacheKey_;                              // non-empty to memoize rendered output in the RenderCache
 
 protected:
     BaseMarkup() {
@@ -85,6 +156,18 @@ public:
      *  This function is a shortcut for setting the @ref versionString and @ref versionDate properties. */
     BaseMarkup& version(const std::string &versionString, const std::string &versionDate);
 
+    /** Property: Rendering cache key.
+     *
+     *  If this property is non-empty then rendered documents are memoized in the @ref RenderCache, and rendering the same
+     *  input again with the same page properties, subclass rendering properties (such as @ref TextMarkup page headers and
+     *  footers) and cache key returns the saved document. The key must describe whatever else affects rendering, such as the
+     *  state of functions that were added to the grammar. The default is empty, which disables caching.
+     *
+     * @{ */
+    const std::string& cacheKey() const { return cacheKey_; }
+    BaseMarkup& cacheKey(const std::string &s) { cacheKey_ = s; return *this; }
+    /** @} */
+
     /** Parse input to generate POD. */
     virtual std::string operator()(const std::string&) /*override*/;
 
@@ -107,6 +190,9 @@ protected:
     // Last thing called before the rendered document is returend
     virtual std::string finalizeDocument(const std::string &s) { return s; }
 
+    // Subclass state that affects the rendered document, added to the render cache key
+    virtual std::string cacheKeyState() const { return std::string(); }
+
 private:
     void init();
 };
@@ -6,6 +6,7 @@
 #include <Sawyer/LineVector.h>
 #include <Sawyer/Map.h>
 #include <Sawyer/Sawyer.h>
+#include <Sawyer/Synchronization.h>
 
 #include <boost/algorithm/string/join.hpp>
 #include <boost/regex.hpp>
@@ -27,6 +28,7 @@ namespace Document {
 namespace Markup {
 
 class Grammar;
+class Template;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //                                      Token
@@ -53,6 +55,7 @@ class SAWYER_EXPORT TokenStream: public Lexer::TokenStream<Token> {
 
 public:
     explicit TokenStream(const std::string &s): Lexer::TokenStream<Token>(s) {}
+    explicit TokenStream(const Container::Buffer<size_t, char>::Ptr &buffer): Lexer::TokenStream<Token>(buffer) {}
     Token scanNextToken(const Container::LineVector &content, size_t &at /*in,out*/);
 };
 
@@ -146,6 +149,13 @@ public:
 
     /** How to evaluate this function or macro. */
     virtual std::string eval(const Grammar&, const std::vector<std::string> &actuals) = 0;
+
+    /** Whether the result depends only on the actual arguments.
+     *
+     *  A pure function has no side effects and its return value depends only on its actual arguments. When a grammar compiles
+     *  markup it evaluates calls to pure functions whose arguments are all constant and replaces the call with the result.
+     *  Most functions are not pure, therefore the default implementation returns false. */
+    virtual bool isPure() const { return false; }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +173,7 @@ class SAWYER_EXPORT ErrorLocation {
         size_t offset;                                  // beginning position within the line
         std::string input;                              // line of input causing error
         Frame(TokenStream &where, const std::string &mesg);
+        Frame(const Template&, size_t where, const std::string &mesg);
     };
 
     // Use the destructor to add a record to the stack frame. We could have used try/catch but that would interfere with
@@ -173,17 +184,25 @@ class SAWYER_EXPORT ErrorLocation {
     //         trap.passed();
     //     }
     //
-    // Any failure to reach trap.passed() will add a stack frame to the location.
+    // Any failure to reach trap.passed() will add a stack frame to the location. When evaluating a template, the frame
+    // describes the input position stored in "where" at the time the exception is thrown.
     class Trap {
         ErrorLocation &eloc_;
-        TokenStream &tokens_;
+        TokenStream *tokens_;                           // input when evaluating directly, or else
+        const Template *tmpl_;                          // the template being evaluated and
+        const size_t *where_;                           // the position within its input
         std::string mesg_;
         bool passed_;
 
     public:
         Trap(ErrorLocation &eloc, TokenStream &tokens, const std::string &mesg)
-            : eloc_(eloc), tokens_(tokens), mesg_(mesg), passed_(false) {}
-        ~Trap() { if (!passed_) eloc_.push(Frame(tokens_, mesg_)); }
+            : eloc_(eloc), tokens_(&tokens), tmpl_(NULL), where_(NULL), mesg_(mesg), passed_(false) {}
+        Trap(ErrorLocation &eloc, const Template &tmpl, const size_t &where, const std::string &mesg)
+            : eloc_(eloc), tokens_(NULL), tmpl_(&tmpl), where_(&where), mesg_(mesg), passed_(false) {}
+        ~Trap() {
+            if (!passed_)
+                eloc_.push(tokens_ ? Frame(*tokens_, mesg_) : Frame(*tmpl_, *where_, mesg_));
+        }
         void passed() { passed_ = true; }
     };
 
@@ -233,6 +252,7 @@ public:
         return Ptr(new StaticContent(name, str));
     }
     std::string eval(const Grammar&, const std::vector<std::string> &args);
+    bool isPure() const { return true; }
 };
 
 /** Function that generates an error message.
@@ -263,6 +283,7 @@ public:
         return Ptr(new Quote(name))->ellipsis();
     }
     std::string eval(const Grammar&, const std::vector<std::string> &args);
+    bool isPure() const { return true; }
 };
 
 /** Evaluate arguments a second time.
@@ -306,6 +327,7 @@ public:
         return Ptr(new Concat(name))->ellipsis();
     }
     std::string eval(const Grammar &grammar, const std::vector<std::string> &args);
+    bool isPure() const { return true; }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,7 +342,8 @@ public:
 class SAWYER_EXPORT Reflow {
     size_t indentLevel_;
     std::string indentation_;                           // string for one level of indentation
-    std::ostringstream out_;
+    std::string prefix_;                                // indentation_ repeated indentLevel_ times
+    std::string out_;                                   // reflowed output
     size_t column_;
     std::string spaces_;                                // accumulated white space
     std::string nonspaces_;                             // non-spaces following accumulated space
@@ -352,7 +375,7 @@ public:
      *
      * @{ */
     const std::string& indentationString() const { return indentation_; }
-    Reflow& indentationString(const std::string &s) { indentation_ = s; return *this; }
+    Reflow& indentationString(const std::string &s) { indentation_ = s; updatePrefix(); return *this; }
     /** @} */
 
     /** Increase or decrease indentation.
@@ -374,7 +397,8 @@ public:
 
     /** Insert text.
      *
-     *  The specified string is inserted into the reflow engine. */
+     *  The specified string is inserted into the reflow engine. The text is scanned once as alternating runs of white space
+     *  and non-white space, and each word is laid out as soon as the white space following it is seen. */
     Reflow& operator()(const std::string &s);
 
     /** Extract the reflowed string.
@@ -385,16 +409,95 @@ public:
 private:
     void emitIndentation();               // indent if we're at the beginning of a line. Also discards accumulated white space.
     void emitAccumulated();               // optionally indent and emit accumulated space and non-space
+    void emitWord(const char *word, size_t size); // like emitAccumulated but for a word that wasn't accumulated
     void emitNewLine();                   // advance to the next line without emitting accumulated text or indentation.
+    void updatePrefix();                  // recompute prefix_ after changing the indentation.
 };
     
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Template
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Compiled markup.
+ *
+ *  A template is the result of parsing a markup string with a particular grammar. The markup is parsed only once, function
+ *  names are resolved to the functions declared in the grammar at the time of compilation, and adjacent text and calls to
+ *  pure functions with constant arguments are folded into single text strings. Evaluating a template produces the same
+ *  result and the same errors as evaluating the markup string from which it was compiled.
+ *
+ *  Templates are immutable and are created by @ref Grammar::compile. */
+class SAWYER_EXPORT Template: public SharedObject {
+    friend class Grammar;
+    friend class ErrorLocation;
+
+public:
+    /** Reference-counting pointer to a compiled template. */
+    typedef SharedPointer<Template> Ptr;
+
+private:
+    static const size_t EOF_POSITION = (size_t)(-1);
+
+    // One node of the syntax tree. Nodes refer to their children by index so they can all be stored in one vector.
+    struct Node {
+        enum Type {
+            NODE_TEXT,                                  // literal text
+            NODE_CALL,                                  // call a function with the evaluated arguments
+            NODE_ERROR                                  // throw a syntax error
+        };
+
+        Type type;
+        std::string text;                               // literal text, or error message for CALL and ERROR nodes
+        Function::Ptr function;                         // function to call for CALL nodes
+        std::vector<std::vector<size_t> > args;         // actual arguments for CALL nodes; each is a sequence of nodes
+        size_t where;                                   // input position for error messages
+
+        explicit Node(Type type, size_t where = EOF_POSITION)
+            : type(type), where(where) {}
+    };
+
+    Container::LineVector content_;                     // input from which this template was compiled
+    std::string name_;                                  // name of the input for error messages
+    std::vector<Node> nodes_;                           // all nodes of the syntax tree
+    std::vector<size_t> body_;                          // top-level sequence of nodes
+
+    explicit Template(const Container::Buffer<size_t, char>::Ptr &buffer)
+        : content_(buffer), name_("string") {}
+
+public:
+    /** Number of nodes in the syntax tree.
+     *
+     *  This is mostly for testing and debugging; it shows how well the compiler was able to fold constant subtrees. */
+    size_t nNodes() const {
+        return nodes_.size();
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //                                      Grammar
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /** Grammar declaration. */
 class SAWYER_EXPORT Grammar {
+    // Recently evaluated markup strings and their templates. A string is compiled the second time it's evaluated, so its
+    // template is null until then. Copying a grammar doesn't copy the cache. This class is thread safe.
+    class SAWYER_EXPORT TemplateCache {
+        mutable SAWYER_THREAD_TRAITS::Mutex mutex_;     // protects all following data members
+        Container::Map<std::string, Template::Ptr> templates_;
+    public:
+        TemplateCache() {}
+        TemplateCache(const TemplateCache&) {}
+        TemplateCache& operator=(const TemplateCache&) { clear(); return *this; }
+
+        // If the string was seen before, returns true and its template, which is null if it wasn't compiled yet. Otherwise
+        // remembers the string and returns false.
+        bool lookup(const std::string&, Template::Ptr &tmpl /*out*/);
+
+        void insert(const std::string&, const Template::Ptr&);
+        void clear();
+    };
+
     Container::Map<std::string, Function::Ptr> functions_;         // functions indexed by their names
+    mutable TemplateCache templates_;                               // recently evaluated markup strings
     static const bool CONSUME = true;
     static const bool LEAVE = false;
 
@@ -406,9 +509,25 @@ public:
      *  Also removes any previously declared function with the same name. */
     Grammar& with(const Function::Ptr&);
 
-    /** Evaluate an entire string. */
+    /** Evaluate an entire string.
+     *
+     *  The first time a string is seen it's evaluated directly. If the same string is evaluated again (such as the arguments of
+     *  the "eval" and "if" functions) then it's compiled to a template, which is cached so that later evaluations don't need
+     *  to parse it again. This function is thread safe. */
     virtual std::string operator()(const std::string &s) const;
 
+    /** Compile a string.
+     *
+     *  Parses the string and returns a template that can be evaluated any number of times without parsing the input again.
+     *  Syntax errors are not reported until the template is evaluated, at which time they are reported in the same order
+     *  and with the same location information as if the string had been evaluated directly. The template refers to the
+     *  functions that are declared when it's compiled, therefore declaring functions afterward has no effect on the
+     *  template. */
+    Template::Ptr compile(const std::string &s) const;
+
+    /** Evaluate a compiled template. */
+    std::string evaluate(const Template::Ptr&) const;
+
     /** Expand escape sequences "@@", "@{" and "@}". */
     static std::string unescape(const std::string &s);
 
@@ -416,20 +535,35 @@ public:
     static std::string escape(const std::string &s);
     
 private:
-    // Evaluate an entire token stream. Throws an exception if an error occurs.
-    std::string eval(TokenStream &tokens, ErrorLocation&) const;
+    // Append literal text to a sequence of nodes, merging it with the previous node if possible.
+    static void appendText(Template&, std::vector<size_t> &seq, const Lexer::StringView &text);
 
-    // Returns a string up to (and possibly including) the next CHAR_RIGHT that is not balanced by a CHAR_LEFT encountered
-    // during the scanning.  The TOK_RIGHT is consumed if requireRight is set, and an error is thrown if that token is not
-    // found.
-    std::string readArgument(TokenStream&, ErrorLocation&, bool requireRight) const;
+    // Append an error node to a sequence of nodes. Always returns false.
+    static bool appendError(Template&, std::vector<size_t> &seq, TokenStream&, const std::string &mesg);
+
+    // Reads a string up to (and possibly including) the next CHAR_RIGHT that is not balanced by a CHAR_LEFT encountered
+    // during the scanning.  The TOK_RIGHT is consumed if requireRight is set.  Returns false and appends an error node to the
+    // sequence if the argument is malformed.
+    bool readArgument(TokenStream&, Template&, std::vector<size_t> &seq, bool requireRight) const;
+
+    // Compile one argument by parsing up to (and possibly including) the next unbalanced TOK_RIGHT.  The TOK_RIGHT is
+    // consumed if requireRight is set.  Returns false and appends an error node to the sequence if an error is encountered,
+    // in which case compilation stops since evaluation will never proceed past the error.
+    bool compileArgument(TokenStream&, Template&, std::vector<size_t> &seq, bool requireRight) const;
 
-    // Parse one argument by parsing up to (and possibly including) the next unbalanced TOK_RIGHT.  The TOK_RIGHT is consumed
-    // if requireRight is set, and an error is thrown if that token is not found.
+    // Compile one function call.  The current token should be a TOK_FUNCTION.
+    bool compileFunction(TokenStream&, Template&, std::vector<size_t> &seq) const;
+
+    // Evaluate an entire string directly, without compiling it, and the pieces thereof. These are the same as compiling and
+    // then evaluating, but faster for markup that's evaluated only once.
+    std::string evalDirectly(const std::string&) const;
+    std::string eval(TokenStream&, ErrorLocation&) const;
+    std::string readArgument(TokenStream&, ErrorLocation&, bool requireRight) const;
     std::string evalArgument(TokenStream&, ErrorLocation&, bool requireRight) const;
-    
-    // Parse one function.  The current token should be a TOK_FUNCTION.
     std::string evalFunction(TokenStream&, ErrorLocation&) const;
+
+    // Evaluate a sequence of nodes. The "where" argument is updated with the input position of any error.
+    std::string evalSequence(const Template&, const std::vector<size_t> &seq, ErrorLocation&, size_t &where) const;
 };
 
 } // namespace
@@ -38,6 +38,7 @@ public:
 private:
     void init();
     std::string finalizeDocument(const std::string &s_);
+    std::string cacheKeyState() const;
 };
 
 } // namespace
@@ -0,0 +1,575 @@
+#ifndef Sawyer_FrozenAddressMap_H
+#define Sawyer_FrozenAddressMap_H
+
+#include <Sawyer/AddressMap.h>
+#include <Sawyer/Assert.h>
+#include <Sawyer/Interval.h>
+#include <Sawyer/Sawyer.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/integer_traits.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+
+/** An immutable address map optimized for lookups.
+ *
+ *  An @ref AddressMap stores its segments in a balanced tree so that it can be modified efficiently, but many maps are never
+ *  modified after they're built; for instance, the map describing a binary specimen once it's been loaded. A frozen map is an
+ *  immutable copy of such a map, created by @ref AddressMap::freeze, that stores its segments in arrays instead.
+ *
+ *  The nodes (address interval and segment pairs) are stored in address order in a single array, so iterating over them
+ *  touches consecutive memory. The greatest address of each segment is also stored in a cache-aligned array in Eytzinger
+ *  order (the order of a breadth-first traversal of a complete binary search tree), which a point lookup searches without
+ *  data-dependent branches while prefetching the keys it will compare against a few levels further down. The tree is padded
+ *  to be full so that the index of the node that was found can be computed from its position in the tree rather than loaded
+ *  from memory. A parallel array in address order holds each segment's least address, accessibility, and a direct pointer
+ *  to its buffer's data, so that a small read is a search, a comparison, and a @c memcpy.
+ *
+ *  All the const operations of an address map that take constraints are available, and they give the same results as the map
+ *  from which this map was frozen:
+ *
+ * @code
+ *  typedef AddressMap<uint64_t, uint8_t> MemoryMap;
+ *  MemoryMap map = ...;
+ *  FrozenAddressMap<uint64_t, uint8_t> frozen = map.freeze();
+ *  Interval<uint64_t> where = frozen.atOrAfter(va).require(Access::EXECUTABLE).limit(16).read(buf);
+ *  size_t nRead = frozen.read(buf, va, 16, Access::READABLE); // same as frozen.at(va).limit(16).require(...).read(...)
+ * @endcode
+ *
+ *  The frozen map references the same buffers as the map it was frozen from. It's the mapping that's immutable, not the values
+ *  stored in the buffers: values written to those buffers through the original map are visible through the frozen map,
+ *  except when the original map replaces a copy-on-write buffer. A buffer must not be resized while a frozen map references
+ *  it. A frozen map is safe to read from multiple threads concurrently. */
+template<class A, class T>
+class FrozenAddressMap {
+public:
+    typedef A Address;                                  /**< Type for addresses. */
+    typedef T Value;                                    /**< Type of data stored in the address space. */
+    typedef AddressSegment<A, T> Segment;               /**< Type of segments stored by this map. */
+    typedef Sawyer::Container::Buffer<Address, Value> Buffer; /**< Type of buffers referenced by segments. */
+
+    /** Address interval and segment pair. */
+    class Node {
+        Sawyer::Container::Interval<Address> key_;
+        Segment value_;
+    public:
+        Node(const Sawyer::Container::Interval<Address> &key, const Segment &value)
+            : key_(key), value_(value) {}
+
+        /** Address interval for this node. */
+        const Sawyer::Container::Interval<Address>& key() const { return key_; }
+
+        /** Segment for this node. */
+        const Segment& value() const { return value_; }
+    };
+
+    typedef const Node* ConstNodeIterator;              /**< Iterates over address interval/segment pairs in the map. */
+    typedef ConstNodeIterator NodeIterator;             /**< Same as ConstNodeIterator since the map is immutable. */
+
+    /** Iterates over segments in the map. */
+    class ConstSegmentIterator: public boost::iterator_adaptor<ConstSegmentIterator, const Node*, const Segment> {
+    public:
+        ConstSegmentIterator() {}
+        ConstSegmentIterator(const Node *node) /*implicit*/: ConstSegmentIterator::iterator_adaptor_(node) {}
+    private:
+        friend class boost::iterator_core_access;
+        const Segment& dereference() const { return this->base()->value(); }
+    };
+
+    typedef ConstSegmentIterator SegmentIterator;       /**< Same as ConstSegmentIterator since the map is immutable. */
+
+    /** Base class for traversals. */
+    class Visitor {
+    public:
+        virtual ~Visitor() {}
+        virtual bool operator()(const FrozenAddressMap&, const Sawyer::Container::Interval<Address>&) = 0;
+    };
+
+private:
+    // Fast-path information for a segment, in address order.
+    struct Extent {
+        Address least;                                  // least address of the segment
+        const Value *data;                              // value at the segment's least address, or null if not available
+        unsigned access;                                // accessibility bits of the segment
+    };
+
+    // Number of search keys per cache line
+    static const size_t KEYS_PER_LINE = 64 / sizeof(Address) > 0 ? 64 / sizeof(Address) : 1;
+
+    std::vector<Node> nodes_;                           // nodes in address order
+    std::vector<Extent> extents_;                       // parallel to nodes_
+    std::vector<Address> keys_;                         // greatest address per segment in Eytzinger order, plus alignment
+    size_t keysOffset_;                                 // index of keys_ element that's Eytzinger slot zero
+    size_t height_;                                     // number of levels in the search tree, which is full
+
+public:
+    /** Constructs an empty map. */
+    FrozenAddressMap()
+        : keysOffset_(0), height_(0) {
+        build();
+    }
+
+    /** Constructs a frozen copy of an address map.
+     *
+     *  The new map has the same addresses mapped to the same buffers as the @p map. See also, @ref AddressMap::freeze. */
+    explicit FrozenAddressMap(const AddressMap<Address, Value> &map)
+        : keysOffset_(0), height_(0) {
+        nodes_.reserve(map.nSegments());
+        for (const typename AddressMap<Address, Value>::Node &node: map.nodes())
+            nodes_.push_back(Node(node.key(), node.value()));
+        build();
+    }
+
+    /** Copy constructor. */
+    FrozenAddressMap(const FrozenAddressMap &other)
+        : nodes_(other.nodes_), keysOffset_(0), height_(0) {
+        build();                                        // the search keys are aligned relative to their own storage
+    }
+
+#if __cplusplus >= 201103L
+    /** Move constructor. */
+    FrozenAddressMap(FrozenAddressMap &&other)
+        : keysOffset_(0), height_(0) {
+        swap(other);
+        other.build();
+    }
+#endif
+
+    /** Assignment. */
+    FrozenAddressMap& operator=(const FrozenAddressMap &other) {
+        if (this != &other) {
+            nodes_ = other.nodes_;
+            build();
+        }
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    /** Move assignment. */
+    FrozenAddressMap& operator=(FrozenAddressMap &&other) {
+        if (this != &other) {
+            swap(other);
+            other.nodes_.clear();
+            other.build();
+        }
+        return *this;
+    }
+#endif
+
+    /** Swap two maps. */
+    void swap(FrozenAddressMap &other) {
+        nodes_.swap(other.nodes_);
+        extents_.swap(other.extents_);
+        keys_.swap(other.keys_);
+        std::swap(keysOffset_, other.keysOffset_);
+        std::swap(height_, other.height_);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Size and iteration
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** True if the map has no segments. */
+    bool isEmpty() const {
+        return nodes_.empty();
+    }
+
+    /** Number of segments contained in the map. */
+    size_t nSegments() const {
+        return nodes_.size();
+    }
+
+    /** Iterator range for all nodes in address order. */
+    boost::iterator_range<ConstNodeIterator> nodes() const {
+        return boost::iterator_range<ConstNodeIterator>(nodes_.data(), nodes_.data() + nodes_.size());
+    }
+
+    /** Iterator range for all segments in address order. */
+    boost::iterator_range<ConstSegmentIterator> segments() const {
+        return boost::iterator_range<ConstSegmentIterator>(nodes().begin(), nodes().end());
+    }
+
+    /** Range of addresses in this map.
+     *
+     *  Returns the interval from the least mapped address to the greatest mapped address, or the empty interval if the map is
+     *  empty. */
+    Sawyer::Container::Interval<Address> hull() const {
+        if (nodes_.empty())
+            return Sawyer::Container::Interval<Address>();
+        return Sawyer::Container::Interval<Address>::hull(nodes_.front().key().least(), nodes_.back().key().greatest());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Point lookups
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Find the first node whose greatest address is greater than or equal to @p va.
+     *
+     *  Returns the end iterator if all mapped addresses are less than @p va. */
+    ConstNodeIterator lowerBound(Address va) const {
+        return nodes_.data() + search(va);
+    }
+
+    /** Find the last node whose least address is less than or equal to @p va.
+     *
+     *  Returns the end iterator if all mapped addresses are greater than @p va. */
+    ConstNodeIterator findPrior(Address va) const {
+        ConstNodeIterator lb = lowerBound(va);
+        if (lb != nodes().end() && lb->key().least() <= va)
+            return lb;
+        if (lb == nodes().begin())
+            return nodes().end();
+        return lb - 1;
+    }
+
+    /** Find the node containing an address.
+     *
+     *  Returns the end iterator if @p va is not mapped. */
+    ConstNodeIterator find(Address va) const {
+        const size_t i = search(va);
+        return nodes_.data() + (i < nodes_.size() && va >= nodes_[i].key().least() ? i : nodes_.size());
+    }
+
+    /** Read values.
+     *
+     *  Reads up to @p n values starting at address @p va into @p buf and returns the number of values read. Reading stops at
+     *  the first address that's not mapped, or whose segment lacks any of the @p requiredAccess bits. The result is the same
+     *  as <code>map.at(va).limit(n).require(requiredAccess).read(buf).size()</code> but without building and matching
+     *  constraints. */
+    size_t read(Value *buf, Address va, size_t n, unsigned requiredAccess = 0) const {
+        if (0 == n)
+            return 0;
+        size_t nRead = 0;
+        for (size_t i = search(va); i < extents_.size() && nRead < n; ++i) {
+            if (va < extents_[i].least || (extents_[i].access & requiredAccess) != requiredAccess)
+                break;                                  // not mapped, or wrong permissions
+            Address offset = va - extents_[i].least;
+            size_t nValues = std::min(n - nRead - 1, size_t(nodes_[i].key().greatest() - va)) + 1;
+            if (extents_[i].data) {
+                memcpy(buf + nRead, extents_[i].data + offset, nValues * sizeof(Value));
+            } else if (nodes_[i].value().buffer()->read(buf + nRead, nodes_[i].value().offset() + offset, nValues) != nValues) {
+                ASSERT_not_reachable("something is wrong with the memory map");
+            }
+            nRead += nValues;
+            va += nValues;
+            if (va == 0)
+                break;                                  // address overflow
+        }
+        return nRead;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Constraints
+    //
+    // These are the same as for AddressMap, where they're documented, except only the const versions exist.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Constraint: required access bits. */
+    AddressMapConstraints<const FrozenAddressMap> require(unsigned x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).require(x);
+    }
+
+    /** Constraint: prohibited access bits. */
+    AddressMapConstraints<const FrozenAddressMap> prohibit(unsigned x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).prohibit(x);
+    }
+
+    /** Constraint: required and prohibited access bits. */
+    AddressMapConstraints<const FrozenAddressMap> access(unsigned x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).access(x);
+    }
+
+    /** Constraint: segment name substring. */
+    AddressMapConstraints<const FrozenAddressMap> substr(const std::string &x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).substr(x);
+    }
+
+    /** Constraint: anchor point or anchored interval.
+     *
+     * @{ */
+    AddressMapConstraints<const FrozenAddressMap> at(Address x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).at(x);
+    }
+    AddressMapConstraints<const FrozenAddressMap> at(const Sawyer::Container::Interval<Address> &x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).at(x);
+    }
+    /** @} */
+
+    /** Constraint: limit matched size. */
+    AddressMapConstraints<const FrozenAddressMap> limit(size_t x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).limit(x);
+    }
+
+    /** Constraint: address lower bound. */
+    AddressMapConstraints<const FrozenAddressMap> atOrAfter(Address x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).atOrAfter(x);
+    }
+
+    /** Constraint: address upper bound. */
+    AddressMapConstraints<const FrozenAddressMap> atOrBefore(Address x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).atOrBefore(x);
+    }
+
+    /** Constraint: address lower and upper bounds.
+     *
+     * @{ */
+    AddressMapConstraints<const FrozenAddressMap> within(const Sawyer::Container::Interval<Address> &x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).within(x);
+    }
+    AddressMapConstraints<const FrozenAddressMap> within(Address x, Address y) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).within(x, y);
+    }
+    AddressMapConstraints<const FrozenAddressMap> baseSize(Address base, Address size) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).baseSize(base, size);
+    }
+    /** @} */
+
+    /** Constraint: address lower bound. */
+    AddressMapConstraints<const FrozenAddressMap> after(Address x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).after(x);
+    }
+
+    /** Constraint: address upper bound. */
+    AddressMapConstraints<const FrozenAddressMap> before(Address x) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).before(x);
+    }
+
+    /** Constraint: single segment. */
+    AddressMapConstraints<const FrozenAddressMap> singleSegment() const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).singleSegment();
+    }
+
+    /** Constraint: arbitrary segment constraint. */
+    AddressMapConstraints<const FrozenAddressMap> segmentPredicate(SegmentPredicate<Address, Value> *p) const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).segmentPredicate(p);
+    }
+
+    /** Constraint: matches anything. */
+    AddressMapConstraints<const FrozenAddressMap> any() const {
+        return AddressMapConstraints<const FrozenAddressMap>(this);
+    }
+
+    /** Constraint: matches nothing. */
+    AddressMapConstraints<const FrozenAddressMap> none() const {
+        return AddressMapConstraints<const FrozenAddressMap>(this).none();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Operations on constraints
+    //
+    // These are the same as for AddressMap, where they're documented.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Segments that overlap with constraints. */
+    boost::iterator_range<ConstSegmentIterator>
+    segments(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        boost::iterator_range<ConstNodeIterator> found = nodes(c, flags);
+        return boost::iterator_range<ConstSegmentIterator>(found.begin(), found.end());
+    }
+
+    /** Nodes that overlap with constraints. */
+    boost::iterator_range<ConstNodeIterator>
+    nodes(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        using namespace AddressMapImpl;
+        if (0==(flags & (MATCH_CONTIGUOUS|MATCH_NONCONTIGUOUS)))
+            flags |= MATCH_CONTIGUOUS;
+        return matchConstraints(*this, c, flags).nodes_;
+    }
+
+    /** Minimum or maximum address that satisfies constraints. */
+    Optional<Address>
+    next(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        using namespace AddressMapImpl;
+        if (0==(flags & (MATCH_CONTIGUOUS|MATCH_NONCONTIGUOUS)))
+            flags |= MATCH_CONTIGUOUS;
+        MatchedConstraints<const FrozenAddressMap> m = matchConstraints(*this, c.limit(1), flags);
+        return m.interval_.isEmpty() ? Optional<Address>() : Optional<Address>(m.interval_.least());
+    }
+
+    /** Address interval that satisfies constraints. */
+    Sawyer::Container::Interval<Address>
+    available(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        using namespace AddressMapImpl;
+        if (0==(flags & (MATCH_CONTIGUOUS|MATCH_NONCONTIGUOUS)))
+            flags |= MATCH_CONTIGUOUS;
+        return matchConstraints(*this, c, flags).interval_;
+    }
+
+    /** Determines if an address exists with the specified constraints. */
+    bool exists(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        return next(c, flags);
+    }
+
+    /** Find node containing the first or last address that satisfies the constraints. */
+    ConstNodeIterator findNode(const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        return nodes(c.limit(1), flags).begin();
+    }
+
+    /** Find unmapped interval.
+     *
+     *  Searches for the lowest (or highest if direction is @c MATCH_BACKWARD) interval that is not mapped and returns it. The
+     *  returned interval will not contain addresses that are less than (or greater than) @p boundary. If no such interval
+     *  exists then the empty interval is returned. */
+    Sawyer::Container::Interval<Address>
+    unmapped(Address boundary, MatchFlags flags=0) const {
+        typedef Sawyer::Container::Interval<Address> AddressInterval;
+        const AddressInterval all = AddressInterval::whole();
+        if ((flags & MATCH_BACKWARD) != 0) {
+            for (ConstNodeIterator iter = findPrior(boundary); iter != nodes().end(); --iter) {
+                if (boundary > iter->key().greatest())
+                    return AddressInterval::hull(iter->key().greatest() + 1, boundary);
+                if (iter->key().least() == all.least())
+                    return AddressInterval();           // no unmapped addresses, and avoid overflow in next statement
+                boundary = iter->key().least() - 1;
+                if (iter == nodes().begin())
+                    break;
+            }
+            return AddressInterval::hull(all.least(), boundary);
+        } else {
+            for (ConstNodeIterator iter = lowerBound(boundary); iter != nodes().end(); ++iter) {
+                if (boundary < iter->key().least())
+                    return AddressInterval::hull(boundary, iter->key().least() - 1);
+                if (iter->key().greatest() == all.greatest())
+                    return AddressInterval();           // no unmapped addresses, and avoid overflow in next statement
+                boundary = iter->key().greatest() + 1;
+            }
+            return AddressInterval::hull(boundary, all.greatest());
+        }
+    }
+
+    /** Invoke a function on each address interval.
+     *
+     * @{ */
+    template<typename Functor>
+    void traverse(Functor &functor, const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        using namespace AddressMapImpl;
+        MatchedConstraints<const FrozenAddressMap> m = matchConstraints(*this, c, flags);
+        for (const Node &node: m.nodes_) {
+            Sawyer::Container::Interval<Address> part = m.interval_ & node.key();
+            if (!functor(*this, part))
+                return;
+        }
+    }
+    void traverse(Visitor &visitor, const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        traverse<Visitor>(visitor, c, flags);
+    }
+    /** @} */
+
+    /** Reads data into the supplied buffer.
+     *
+     * @{ */
+    Sawyer::Container::Interval<Address>
+    read(Value *buf /*out*/, const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        using namespace AddressMapImpl;
+        ASSERT_require2(0 == (flags & MATCH_NONCONTIGUOUS), "only contiguous addresses can be read");
+        if (0==(flags & (MATCH_CONTIGUOUS|MATCH_NONCONTIGUOUS)))
+            flags |= MATCH_CONTIGUOUS;
+        MatchedConstraints<const FrozenAddressMap> m = matchConstraints(*this, c, flags);
+        if (buf) {
+            for (ConstNodeIterator node = m.nodes_.begin(); node != m.nodes_.end(); ++node) {
+                Sawyer::Container::Interval<Address> part = m.interval_ & node->key(); // part of segment to read
+                ASSERT_forbid(part.isEmpty());
+                Address offset = part.least() - node->key().least();
+                if (const Value *data = extents_[node - nodes_.data()].data) {
+                    memcpy(buf, data + offset, part.size() * sizeof(Value));
+                } else if (node->value().buffer()->read(buf, node->value().offset() + offset, part.size()) != part.size()) {
+                    ASSERT_not_reachable("something is wrong with the memory map");
+                }
+                buf += part.size();
+            }
+        }
+        return m.interval_;
+    }
+
+    Sawyer::Container::Interval<Address>
+    read(std::vector<Value> &buf /*out*/, const AddressMapConstraints<const FrozenAddressMap> &c, MatchFlags flags=0) const {
+        return buf.empty() ? Sawyer::Container::Interval<Address>() : read(&buf[0], c.limit(buf.size()), flags);
+    }
+    /** @} */
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Private functions
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    // Build the search arrays from nodes_.
+    void build() {
+        const size_t n = nodes_.size();
+        extents_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            const Segment &segment = nodes_[i].value();
+            extents_[i].least = nodes_[i].key().least();
+            extents_[i].data = NULL;
+            extents_[i].access = segment.accessibility();
+            if (const Buffer *buffer = segment.buffer().getRawPointer()) {
+                if (buffer->data() && buffer->available(segment.offset()) >= nodes_[i].key().size())
+                    extents_[i].data = buffer->data() + segment.offset();
+            }
+        }
+
+        // The search tree is full, with keys greater than all addresses in the extra slots, so that the node index of each slot
+        // can be computed. Extra keys are allocated so that slot zero can be placed at the start of a cache line.
+        height_ = 0;
+        while (((size_t(1) << height_) - 1) < n)
+            ++height_;
+        const size_t treeSize = (size_t(1) << height_) - 1;
+        keys_.clear();
+        keys_.resize(treeSize + 1 + KEYS_PER_LINE, boost::integer_traits<Address>::const_max);
+        const size_t misalignment = (size_t)((boost::uintptr_t)keys_.data() % 64);
+        keysOffset_ = misalignment > 0 ? (64 - misalignment) / sizeof(Address) : 0;
+        for (size_t k = 1; k <= treeSize; ++k) {
+            size_t i = nodeIndex(k);
+            if (i < n)
+                keys_[keysOffset_ + k] = nodes_[i].key().greatest();
+        }
+    }
+
+    // Index of the node at Eytzinger slot k, which is its in-order position in the full tree.
+    size_t nodeIndex(size_t k) const {
+        size_t depth = 0;                               // depth of slot k, the root being at depth zero
+#ifdef __GNUC__
+        depth = 8 * sizeof(unsigned long long) - 1 - __builtin_clzll(k);
+#else
+        for (size_t x = k; x > 1; x >>= 1)
+            ++depth;
+#endif
+        return ((2 * (k - (size_t(1) << depth)) + 1) << (height_ - 1 - depth)) - 1;
+    }
+
+    // Returns the index of the first node whose greatest address is greater than or equal to va, or the number of nodes if
+    // there is no such node. The loop body has no branches other than the loop condition, whose outcome depends only on the
+    // size of the map.
+    size_t search(Address va) const {
+        const Address *keys = keys_.data() + keysOffset_;
+        const size_t treeSize = (size_t(1) << height_) - 1;
+        size_t k = 1;
+        while (k <= treeSize) {
+#ifdef __GNUC__
+            // Prefetch the cache line holding this slot's descendants a few levels down. Prefetching past the end is harmless.
+            __builtin_prefetch((const void*)((boost::uintptr_t)keys + k * KEYS_PER_LINE * sizeof(Address)));
+#endif
+            k = 2 * k + (keys[k] < va ? 1 : 0);
+        }
+
+        // The bits of k are the path taken from the root, a one for each right turn. The answer is the last node where we
+        // turned left, so remove the trailing right turns and then that left turn.
+#ifdef __GNUC__
+        k >>= __builtin_ctzll(~(unsigned long long)k) + 1;
+#else
+        while ((k & 1) != 0)
+            k >>= 1;
+        k >>= 1;
+#endif
+        return 0 == k ? nodes_.size() : std::min(nodeIndex(k), nodes_.size());
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -14,6 +14,7 @@
 #include <boost/serialization/split_member.hpp>
 #include <boost/unordered_map.hpp>
 #include <ostream>
+#include <vector>
 #if 1 /*DEBUGGING [Robb Matzke 2014-04-21]*/
 #include <iomanip>
 #endif
@@ -1913,6 +1914,93 @@ public:
     }
     /** @} */
 
+    /** Erases many vertices and their incident edges.
+     *
+     *  Erases the vertices whose ID numbers are listed in @p ids, or for which @p predicate returns true when called with a
+     *  const reference to a @ref Vertex, along with all edges that originate from or terminate at those vertices. Listing an
+     *  ID more than once has the same effect as listing it once.
+     *
+     *  As with @ref eraseVertex, the vertices and edges with the highest ID numbers are renumbered to fill the gaps, but each
+     *  is renumbered only once, and an edge between two erased vertices is not unlinked from either vertex's edge lists.
+     *  Returns a table indexed by old vertex ID that contains each vertex's new ID, or <code>(size_t)(-1)</code> if the vertex
+     *  was erased.  If @p edgeIdMap is specified then it's set to the similar table for edge ID numbers.  Iterators that
+     *  pointed to erased vertices and edges become invalid; other iterators are unaffected.
+     *
+     *  Time complexity is linear in the number of vertices and edges in the graph, plus the time to erase keys from the
+     *  indexes, if any.
+     *
+     * @{ */
+    std::vector<size_t> eraseVertices(const std::vector<size_t> &ids) {
+        std::vector<size_t> edgeIdMap;
+        return eraseVertices(ids, edgeIdMap);
+    }
+    std::vector<size_t> eraseVertices(const std::vector<size_t> &ids, std::vector<size_t> &edgeIdMap /*out*/) {
+        std::vector<bool> vertexMarks(nVertices(), false), edgeMarks(nEdges(), false);
+        for (size_t i=0; i<ids.size(); ++i) {
+            const size_t id = ids[i];
+            ASSERT_require(id < nVertices());
+            vertexMarks[id] = true;
+        }
+        std::vector<size_t> vertexIdMap;
+        eraseMarked(vertexMarks, edgeMarks, vertexIdMap, edgeIdMap);
+        return vertexIdMap;
+    }
+    template<class VertexPredicate>
+    std::vector<size_t> eraseVertices(VertexPredicate predicate) {
+        std::vector<size_t> edgeIdMap;
+        return eraseVertices(predicate, edgeIdMap);
+    }
+    template<class VertexPredicate>
+    std::vector<size_t> eraseVertices(VertexPredicate predicate, std::vector<size_t> &edgeIdMap /*out*/) {
+        std::vector<bool> vertexMarks(nVertices(), false), edgeMarks(nEdges(), false);
+        for (size_t id=0; id<nVertices(); ++id) {
+            const Vertex &vertex = vertices_.indexedValue(id);
+            vertexMarks[id] = predicate(vertex);
+        }
+        std::vector<size_t> vertexIdMap;
+        eraseMarked(vertexMarks, edgeMarks, vertexIdMap, edgeIdMap);
+        return vertexIdMap;
+    }
+    /** @} */
+
+    /** Erases many edges.
+     *
+     *  Erases the edges whose ID numbers are listed in @p ids, or for which @p predicate returns true when called with a const
+     *  reference to an @ref Edge. Listing an ID more than once has the same effect as listing it once.  Vertices are not
+     *  erased, and their ID numbers don't change.
+     *
+     *  As with @ref eraseEdge, the edges with the highest ID numbers are renumbered to fill the gaps, but each is renumbered
+     *  only once.  Returns a table indexed by old edge ID that contains each edge's new ID, or <code>(size_t)(-1)</code> if the
+     *  edge was erased.  Iterators that pointed to erased edges become invalid; other iterators are unaffected.
+     *
+     *  Time complexity is linear in the number of vertices and edges in the graph plus the time to erase keys from the edge
+     *  index, if any.
+     *
+     * @{ */
+    std::vector<size_t> eraseEdges(const std::vector<size_t> &ids) {
+        std::vector<bool> vertexMarks(nVertices(), false), edgeMarks(nEdges(), false);
+        for (size_t i=0; i<ids.size(); ++i) {
+            const size_t id = ids[i];
+            ASSERT_require(id < nEdges());
+            edgeMarks[id] = true;
+        }
+        std::vector<size_t> vertexIdMap, edgeIdMap;
+        eraseMarked(vertexMarks, edgeMarks, vertexIdMap, edgeIdMap);
+        return edgeIdMap;
+    }
+    template<class EdgePredicate>
+    std::vector<size_t> eraseEdges(EdgePredicate predicate) {
+        std::vector<bool> vertexMarks(nVertices(), false), edgeMarks(nEdges(), false);
+        for (size_t id=0; id<nEdges(); ++id) {
+            const Edge &edge = edges_.indexedValue(id);
+            edgeMarks[id] = predicate(edge);
+        }
+        std::vector<size_t> vertexIdMap, edgeIdMap;
+        eraseMarked(vertexMarks, edgeMarks, vertexIdMap, edgeIdMap);
+        return edgeIdMap;
+    }
+    /** @} */
+
     /** Erase all edges, but leave all vertices.
      *
      *  This method erases (withdraws and deletes) all edges but leaves all vertices. It is logically equivalent to calling
@@ -2043,6 +2131,65 @@ private:
         return newEdge;
     }
 
+    // Erases the marked vertices, the marked edges, and the edges incident to marked vertices. An edge between two erased
+    // vertices needs no unlinking, and an edge with one erased vertex is unlinked only from the other vertex's list.
+    void eraseMarked(const std::vector<bool> &vertexMarks, std::vector<bool> &edgeMarks,
+                     std::vector<size_t> &vertexIdMap /*out*/, std::vector<size_t> &edgeIdMap /*out*/) {
+        ASSERT_require(vertexMarks.size() == nVertices());
+        ASSERT_require(edgeMarks.size() == nEdges());
+
+        // Explicitly marked edges whose vertices both remain
+        for (size_t id=0; id<nEdges(); ++id) {
+            if (edgeMarks[id]) {
+                Edge &edge = edges_.indexedValue(id);
+                if (!vertexMarks[edge.source_->id()] && !vertexMarks[edge.target_->id()]) {
+                    edgeIndex_.erase(EdgeKey(edge.value()));
+                    unlinkEdge(edge);
+                }
+            }
+        }
+
+        // Edges incident to erased vertices. The erased vertex's own lists are abandoned.
+        for (size_t id=0; id<nVertices(); ++id) {
+            if (vertexMarks[id]) {
+                Vertex &vertex = vertices_.indexedValue(id);
+                for (EdgeIterator edge=vertex.outEdges().begin(); edge!=vertex.outEdges().end(); ++edge) {
+                    Vertex &target = *edge->target_;
+                    if (!vertexMarks[target.id()]) {
+                        edgeIndex_.erase(EdgeKey(edge->value()));
+                        edgeMarks[edge->id()] = true;
+                        --target.nInEdges_;
+                        edge->edgeLists_.remove(IN_EDGES);
+                    } else {                                // seen only here, not in the target's in-edges
+                        edgeIndex_.erase(EdgeKey(edge->value()));
+                        edgeMarks[edge->id()] = true;
+                    }
+                }
+                for (EdgeIterator edge=vertex.inEdges().begin(); edge!=vertex.inEdges().end(); ++edge) {
+                    Vertex &source = *edge->source_;
+                    if (!vertexMarks[source.id()]) {
+                        edgeIndex_.erase(EdgeKey(edge->value()));
+                        edgeMarks[edge->id()] = true;
+                        --source.nOutEdges_;
+                        edge->edgeLists_.remove(OUT_EDGES);
+                    }
+                }
+                vertexIndex_.erase(VertexKey(vertex.value()));
+            }
+        }
+
+        edgeIdMap = edges_.eraseMarked(edgeMarks);
+        vertexIdMap = vertices_.eraseMarked(vertexMarks);
+    }
+
+    // Removes an edge from the edge lists of its vertices.
+    void unlinkEdge(Edge &edge) {
+        --edge.source_->nOutEdges_;
+        edge.edgeLists_.remove(OUT_EDGES);
+        --edge.target_->nInEdges_;
+        edge.edgeLists_.remove(IN_EDGES);
+    }
+
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Deprecated stuff
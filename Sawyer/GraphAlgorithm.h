@@ -8,7 +8,11 @@
 #include <Sawyer/GraphIteratorMap.h>
 #include <Sawyer/GraphTraversal.h>
 #include <Sawyer/Set.h>
+#include <Sawyer/Synchronization.h>
 
+#include <algorithm>
+#include <atomic>
+#include <boost/cstdint.hpp>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
 #include <iostream>
@@ -201,6 +205,247 @@ graphFindConnectedComponents(const Graph &g, std::vector<size_t> &components /*o
     return nComponents;
 }
 
+namespace GraphAlgorithmImpl {
+
+// Union-find over vertex ID numbers that many threads can update at once without locking. Each set is represented by its
+// smallest member: a root is only ever linked beneath a smaller root, so parent IDs never exceed child IDs and the forest can't
+// form a cycle. Paths are halved during each find. All updates are single compare-and-swap operations on one parent, which is
+// why relaxed memory ordering suffices: a stale parent is still an ancestor, and a stale root fails the linking CAS.
+class ConcurrentUnionFind {
+    std::vector<std::atomic<size_t> > parents_;
+
+public:
+    explicit ConcurrentUnionFind(size_t n)
+        : parents_(n) {
+        for (size_t i = 0; i < n; ++i)
+            parents_[i].store(i, std::memory_order_relaxed);
+    }
+
+    size_t size() const {
+        return parents_.size();
+    }
+
+    // Representative (smallest member) of the set containing x.
+    size_t find(size_t x) {
+        while (true) {
+            size_t parent = parents_[x].load(std::memory_order_relaxed);
+            if (parent == x)
+                return x;
+            size_t grandParent = parents_[parent].load(std::memory_order_relaxed);
+            if (grandParent != parent)
+                parents_[x].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+            x = grandParent;
+        }
+    }
+
+    // Merge the sets containing a and b.
+    void unite(size_t a, size_t b) {
+        while (true) {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return;
+            if (a < b)
+                std::swap(a, b);
+            size_t expected = a;
+            if (parents_[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+                return;
+        }
+    }
+
+    bool isRoot(size_t x) const {
+        return parents_[x].load(std::memory_order_relaxed) == x;
+    }
+};
+
+// Calls functor(id) for each id in [0, n). Threads claim chunks of IDs from a shared counter so that vertices with many edges
+// don't leave the other threads idle. A thread count of zero means use the hardware concurrency.
+template<class Functor>
+class ParallelIdLoop {
+    size_t n_;
+    size_t chunkSize_;
+    Functor &functor_;
+    std::atomic<size_t> next_;
+
+    struct Worker {
+        ParallelIdLoop *loop;
+        explicit Worker(ParallelIdLoop *loop): loop(loop) {}
+        void operator()() { loop->work(); }
+    };
+
+public:
+    ParallelIdLoop(size_t n, size_t chunkSize, Functor &functor)
+        : n_(n), chunkSize_(std::max(chunkSize, size_t(1))), functor_(functor), next_(0) {}
+
+    void run(size_t nThreads) {
+#if SAWYER_MULTI_THREADED
+        if (0 == nThreads)
+            nThreads = boost::thread::hardware_concurrency();
+        nThreads = std::min(nThreads, (n_ + chunkSize_ - 1) / chunkSize_);
+        if (nThreads > 1) {
+            boost::thread_group workers;
+            for (size_t i = 1; i < nThreads; ++i)
+                workers.create_thread(Worker(this));
+            work();
+            workers.join_all();
+            return;
+        }
+#else
+        (void) nThreads;
+#endif
+        work();
+    }
+
+private:
+    void work() {
+        while (true) {
+            size_t begin = next_.fetch_add(chunkSize_, std::memory_order_relaxed);
+            if (begin >= n_)
+                return;
+            size_t end = std::min(begin + chunkSize_, n_);
+            for (size_t id = begin; id < end; ++id)
+                functor_(id);
+        }
+    }
+};
+
+template<class Functor>
+void
+forEachId(size_t n, size_t nThreads, Functor &functor, size_t chunkSize = 4096) {
+    ParallelIdLoop<Functor>(n, chunkSize, functor).run(nThreads);
+}
+
+// Links each vertex with its first successor and first predecessor. For typical graphs this alone joins most of the largest
+// component.
+template<class Graph>
+class LinkFirstNeighbor {
+    const Graph &g_;
+    ConcurrentUnionFind &sets_;
+
+public:
+    LinkFirstNeighbor(const Graph &g, ConcurrentUnionFind &sets)
+        : g_(g), sets_(sets) {}
+
+    void operator()(size_t id) {
+        typename Graph::ConstVertexIterator vertex = g_.findVertex(id);
+        if (vertex->nOutEdges() > 0)
+            sets_.unite(id, vertex->outEdges().begin()->target()->id());
+        if (vertex->nInEdges() > 0)
+            sets_.unite(id, vertex->inEdges().begin()->source()->id());
+    }
+};
+
+// Links each vertex with all its neighbors unless it's already known to be in the largest set. Both incoming and outgoing edges
+// are followed since an edge whose other endpoint is skipped must still be seen from this end.
+template<class Graph>
+class LinkAllNeighbors {
+    const Graph &g_;
+    ConcurrentUnionFind &sets_;
+    size_t skip_;
+
+public:
+    LinkAllNeighbors(const Graph &g, ConcurrentUnionFind &sets, size_t skip)
+        : g_(g), sets_(sets), skip_(skip) {}
+
+    void operator()(size_t id) {
+        if (sets_.find(id) == skip_)
+            return;
+        typename Graph::ConstVertexIterator vertex = g_.findVertex(id);
+        BOOST_FOREACH (const typename Graph::Edge &edge, vertex->outEdges())
+            sets_.unite(id, edge.target()->id());
+        BOOST_FOREACH (const typename Graph::Edge &edge, vertex->inEdges())
+            sets_.unite(id, edge.source()->id());
+    }
+};
+
+// The most common representative among a sample of vertices, which is probably the representative of the largest set.
+inline size_t
+sampleLargestSet(ConcurrentUnionFind &sets) {
+    static const size_t nSamples = 1024;
+    std::vector<size_t> roots;
+    roots.reserve(nSamples);
+    boost::uint64_t x = 1;
+    for (size_t i = 0; i < nSamples; ++i) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        roots.push_back(sets.find((x >> 16) % sets.size()));
+    }
+    std::sort(roots.begin(), roots.end());
+    size_t best = roots[0], bestCount = 0;
+    for (size_t i = 0, j = 0; i < roots.size(); i = j) {
+        for (j = i + 1; j < roots.size() && roots[j] == roots[i]; ++j) /*void*/;
+        if (j - i > bestCount) {
+            best = roots[i];
+            bestCount = j - i;
+        }
+    }
+    return best;
+}
+
+// Joins the sets of all connected vertices using the Afforest approach: link one neighbor per vertex, find the probable largest
+// component by sampling, then process the edges of all vertices not already in that component.
+template<class Graph>
+void
+connectVertices(const Graph &g, ConcurrentUnionFind &sets, size_t nThreads) {
+    if (sets.size() == 0)
+        return;
+    LinkFirstNeighbor<Graph> linkFirst(g, sets);
+    forEachId(sets.size(), nThreads, linkFirst);
+    LinkAllNeighbors<Graph> linkAll(g, sets, sampleLargestSet(sets));
+    forEachId(sets.size(), nThreads, linkAll);
+}
+
+} // namespace
+
+/** Test whether a graph is connected using multiple threads.
+ *
+ *  Returns the same answer as the single-threaded version, but computes it with a lock-free union-find that links vertex ID
+ *  numbers from @p nThreads threads. If @p nThreads is zero then the hardware concurrency is used. Multiple threads are
+ *  used only if %Sawyer was compiled with thread support.
+ *
+ *  Time complexity is nearly O(|V|+|E|) total work.
+ *
+ *  @sa graphFindConnectedComponents. */
+template<class Graph>
+bool
+graphIsConnected(const Graph &g, size_t nThreads) {
+    GraphAlgorithmImpl::ConcurrentUnionFind sets(g.nVertices());
+    GraphAlgorithmImpl::connectVertices(g, sets, nThreads);
+    size_t nRoots = 0;
+    for (size_t id = 0; id < sets.size() && nRoots < 2; ++id) {
+        if (sets.isRoot(id))
+            ++nRoots;
+    }
+    return nRoots <= 1;
+}
+
+/** Find all connected components of a graph using multiple threads.
+ *
+ *  Fills in @p components exactly like the single-threaded version: components are numbered starting at zero in the order of
+ *  their lowest vertex ID number. The components are found with a lock-free union-find over vertex ID numbers that's updated
+ *  from @p nThreads threads, where zero means use the hardware concurrency. Each vertex is first linked to a single neighbor;
+ *  then a sample of vertices identifies the probable largest component, whose vertices don't need to have their edges
+ *  examined again. Multiple threads are used only if %Sawyer was compiled with thread support.
+ *
+ *  Time complexity is nearly O(|V|+|E|) total work, and usually much less than |E| edges are visited.
+ *
+ *  @sa @ref graphIsConnected. */
+template<class Graph>
+size_t
+graphFindConnectedComponents(const Graph &g, std::vector<size_t> &components /*out*/, size_t nThreads) {
+    GraphAlgorithmImpl::ConcurrentUnionFind sets(g.nVertices());
+    GraphAlgorithmImpl::connectVertices(g, sets, nThreads);
+
+    // Each set's representative is its smallest member, so it has been numbered before any other member is reached.
+    size_t nComponents = 0;
+    components.clear();
+    components.resize(g.nVertices());
+    for (size_t id = 0; id < components.size(); ++id) {
+        size_t root = sets.find(id);
+        components[id] = root == id ? nComponents++ : components[root];
+    }
+    return nComponents;
+}
+
 /** Create a subgraph.
  *
  *  Creates a new graph by copying an existing graph, but copying only those vertices whose ID numbers are specified.  All
@@ -1265,6 +1510,240 @@ graphPostDominators(Graph &g, typename GraphTraits<Graph>::VertexIterator root)
     return graphDirectedDominators<ReverseTraversalTag>(g, root);
 }
 
+namespace GraphAlgorithmImpl {
+
+// Representative of x in a union-find forest stored as parent indexes, halving the path along the way.
+inline size_t
+findSet(std::vector<size_t> &parents, size_t x) {
+    while (parents[x] != x) {
+        parents[x] = parents[parents[x]];
+        x = parents[x];
+    }
+    return x;
+}
+
+} // namespace
+
+/** Loop nesting forest.
+ *
+ *  Describes the loops of a graph and how they nest, as returned by @ref graphLoopNestingForest. All members are flat arrays
+ *  indexed by vertex ID number. A loop is identified by its header vertex, and the loop's body is the header plus all vertices
+ *  whose innermost enclosing loop is that loop or a loop nested within it. */
+struct LoopNestingForest {
+    /** Kind of loop headed by a vertex. */
+    enum LoopType {
+        NONHEADER,                                      /**< Vertex is not a loop header. */
+        SELF_LOOP,                                      /**< Vertex's only loop is an edge to itself. */
+        REDUCIBLE,                                      /**< Vertex heads a loop that has only one entry. */
+        IRREDUCIBLE                                     /**< Vertex heads a loop that can be entered at other vertices too. */
+    };
+
+    /** Value of @ref headers for a vertex that is not in any loop. */
+    static const size_t NO_HEADER = (size_t)(-1);
+
+    /** Innermost enclosing loop header for each vertex.
+     *
+     *  For a vertex that is itself a loop header, this is the header of the next enclosing loop. @ref NO_HEADER means the
+     *  vertex isn't within any (other) loop, or isn't reachable from the root. */
+    std::vector<size_t> headers;
+
+    /** Kind of loop headed by each vertex. */
+    std::vector<LoopType> types;
+
+    /** Loop nesting depth for each vertex.
+     *
+     *  This is the number of loops containing the vertex, where a header is contained in the loop it heads. Vertices that are
+     *  not in any loop have depth zero. */
+    std::vector<size_t> depths;
+
+    /** Vertex ID numbers ordered so that every loop's body is contiguous.
+     *
+     *  The body of the loop headed by @em h is the @c bodySizes[h] vertices starting at @c bodyVertices[bodyIndexes[h]], and the
+     *  header is always first. Only vertices reachable from the root are present. */
+    std::vector<size_t> bodyVertices;
+
+    /** Position of each vertex in @ref bodyVertices, or @ref NO_HEADER if it isn't reachable from the root. */
+    std::vector<size_t> bodyIndexes;
+
+    /** Number of vertices in the loop headed by each vertex, or one if the vertex isn't a header. */
+    std::vector<size_t> bodySizes;
+
+    /** True if the vertex is a loop header. */
+    bool isHeader(size_t vertexId) const {
+        return types[vertexId] != NONHEADER;
+    }
+
+    /** True if loop header @p header contains vertex @p vertexId, including in a nested loop. */
+    bool isInLoop(size_t vertexId, size_t header) const {
+        return bodyIndexes[vertexId] != NO_HEADER && bodyIndexes[header] != NO_HEADER &&
+            bodyIndexes[vertexId] >= bodyIndexes[header] && bodyIndexes[vertexId] < bodyIndexes[header] + bodySizes[header];
+    }
+};
+
+/** Find the loops of a graph and how they nest.
+ *
+ *  Uses Havlak's algorithm to find the loop nesting forest of all vertices reachable from @p root, with Ramalingam's
+ *  correction so that it runs in nearly linear time even when loops are irreducible (have more than one entry). Unlike
+ *  finding natural loops from dominators and back edges, this also finds irreducible loops. The header of an irreducible loop
+ *  is its entry that's first in the depth-first order, and so depends on the order of the edges.
+ *
+ *  See also, @ref graphDominators. */
+template<class Graph>
+LoopNestingForest
+graphLoopNestingForest(Graph &g, typename GraphTraits<Graph>::VertexIterator root) {
+    typedef typename GraphTraits<Graph>::Edge Edge;
+    static const size_t NO_ID = (size_t)(-1);           // same as LoopNestingForest::NO_HEADER
+    ASSERT_require(g.isValidVertex(root));
+
+    // A predecessor edge, and the preorder number of the lowest common depth-first ancestor of its endpoints.
+    struct Pred {
+        size_t source, lca;
+        Pred(size_t source, size_t lca): source(source), lca(lca) {}
+    };
+
+    // Number the vertices in depth-first preorder and classify the edges. A back edge goes to an ancestor (or self); all other
+    // edges are annotated with the lowest common ancestor of their endpoints, found with Tarjan's offline algorithm: once a
+    // vertex is finished it's linked to its parent, so the set containing an earlier vertex is represented by its lowest
+    // ancestor still on the traversal path.
+    std::vector<size_t> preorder(g.nVertices(), NO_ID), vertexIds, ancestors, path;
+    std::vector<std::vector<size_t> > backPreds;
+    std::vector<std::vector<Pred> > nonBackPreds;
+    std::vector<std::vector<std::pair<size_t, size_t> > > byLca; // source and target of each non-back edge, by LCA
+    for (DepthFirstForwardGraphTraversal<Graph> t(g, root, ENTER_VERTEX|LEAVE_VERTEX); t; ++t) {
+        if (t.event() == ENTER_VERTEX) {
+            const size_t v = vertexIds.size();
+            preorder[t.vertex()->id()] = v;
+            vertexIds.push_back(t.vertex()->id());
+            ancestors.push_back(v);
+            backPreds.push_back(std::vector<size_t>());
+            nonBackPreds.push_back(std::vector<Pred>());
+            byLca.push_back(std::vector<std::pair<size_t, size_t> >());
+            path.push_back(v);
+        } else {
+            const size_t v = path.back();
+            BOOST_FOREACH (const Edge &edge, t.vertex()->outEdges()) {
+                const size_t x = preorder[edge.target()->id()];
+                if (x > v) {
+                    nonBackPreds[x].push_back(Pred(v, v)); // tree or forward edge
+                    byLca[v].push_back(std::make_pair(v, x));
+                } else if (ancestors[x] == x) {         // x is still on the path, so it's an ancestor
+                    backPreds[x].push_back(v);
+                } else {
+                    const size_t lca = GraphAlgorithmImpl::findSet(ancestors, x);
+                    nonBackPreds[x].push_back(Pred(v, lca));
+                    byLca[lca].push_back(std::make_pair(v, x));
+                }
+            }
+            path.pop_back();
+            if (!path.empty())
+                ancestors[v] = path.back();
+        }
+    }
+    const size_t n = vertexIds.size();
+
+    // Process vertices from innermost to outermost. Each loop found is collapsed into its header by the union-find so that
+    // enclosing loops see it as a single vertex. An edge from outside a header's subtree into its loop makes the loop
+    // irreducible, and also every enclosing loop whose header is below the edge's LCA; rather than redirecting the edge to each
+    // of those headers in turn (which is quadratic), the least such LCA is passed outward with the collapsed loop. The edge
+    // itself is moved to its target's collapsed loop when its LCA is reached, after which it's an ordinary edge.
+    std::vector<size_t> header(n, NO_ID), sets(n), inPool(n, NO_ID), entryLca(n, NO_ID);
+    std::vector<LoopNestingForest::LoopType> type(n, LoopNestingForest::NONHEADER);
+    for (size_t i = 0; i < n; ++i)
+        sets[i] = i;
+    std::vector<size_t> pool, worklist;
+    for (size_t w = n; w > 0; --w) {
+        const size_t h = w - 1;
+        for (size_t i = 0; i < byLca[h].size(); ++i) {
+            const size_t x = byLca[h][i].second, collapsed = GraphAlgorithmImpl::findSet(sets, x);
+            if (collapsed != x)
+                nonBackPreds[collapsed].push_back(Pred(byLca[h][i].first, h));
+        }
+
+        pool.clear();
+        BOOST_FOREACH (size_t v, backPreds[h]) {
+            if (v == h) {
+                type[h] = LoopNestingForest::SELF_LOOP;
+                continue;
+            }
+            const size_t x = GraphAlgorithmImpl::findSet(sets, v);
+            if (inPool[x] != h) {
+                inPool[x] = h;
+                pool.push_back(x);
+            }
+        }
+        if (pool.empty())
+            continue;
+        type[h] = LoopNestingForest::REDUCIBLE;
+
+        worklist = pool;
+        while (!worklist.empty()) {
+            const size_t x = worklist.back();
+            worklist.pop_back();
+            if (entryLca[x] < h) {
+                type[h] = LoopNestingForest::IRREDUCIBLE;
+                entryLca[h] = std::min(entryLca[h], entryLca[x]);
+            }
+            BOOST_FOREACH (const Pred &pred, nonBackPreds[x]) {
+                if (pred.lca < h) {
+                    // Entry into the loop from outside the header's subtree
+                    type[h] = LoopNestingForest::IRREDUCIBLE;
+                    entryLca[h] = std::min(entryLca[h], pred.lca);
+                } else {
+                    const size_t y = GraphAlgorithmImpl::findSet(sets, pred.source);
+                    if (y != h && inPool[y] != h) {
+                        inPool[y] = h;
+                        pool.push_back(y);
+                        worklist.push_back(y);
+                    }
+                }
+            }
+        }
+
+        BOOST_FOREACH (size_t x, pool) {
+            header[x] = h;
+            sets[x] = h;
+        }
+    }
+
+    // Convert from preorder numbers to vertex IDs. Headers precede their bodies in preorder, so each loop's depth and body
+    // position are known before its members are visited, and its size is known after visiting them in reverse.
+    LoopNestingForest forest;
+    forest.headers.resize(g.nVertices(), NO_ID);
+    forest.types.resize(g.nVertices(), LoopNestingForest::NONHEADER);
+    forest.depths.resize(g.nVertices(), 0);
+    forest.bodyIndexes.resize(g.nVertices(), NO_ID);
+    forest.bodySizes.resize(g.nVertices(), 1);
+    forest.bodyVertices.resize(n);
+
+    std::vector<size_t> size(n, 1), next(n);
+    for (size_t w = n; w > 1; --w) {
+        if (header[w-1] != NO_ID)
+            size[header[w-1]] += size[w-1];
+    }
+    size_t nTopLevel = 0;
+    for (size_t w = 0; w < n; ++w) {
+        const size_t id = vertexIds[w];
+        const bool isHeader = type[w] != LoopNestingForest::NONHEADER;
+        size_t position;
+        if (header[w] == NO_ID) {
+            position = nTopLevel;
+            nTopLevel += size[w];
+            forest.depths[id] = isHeader ? 1 : 0;
+        } else {
+            position = next[header[w]];
+            next[header[w]] += size[w];
+            forest.headers[id] = vertexIds[header[w]];
+            forest.depths[id] = forest.depths[vertexIds[header[w]]] + (isHeader ? 1 : 0);
+        }
+        next[w] = position + 1;
+        forest.types[id] = type[w];
+        forest.bodyIndexes[id] = position;
+        forest.bodySizes[id] = size[w];
+        forest.bodyVertices[position] = id;
+    }
+    return forest;
+}
+
 } // namespace
 } // namespace
 } // namespace
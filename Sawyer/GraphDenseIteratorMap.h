@@ -0,0 +1,424 @@
+#ifndef Sawyer_GraphDenseIteratorMap_H
+#define Sawyer_GraphDenseIteratorMap_H
+
+#include <Sawyer/Graph.h>
+#include <Sawyer/Optional.h>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+namespace Sawyer {
+namespace Container {
+
+/** Map of graph edge or vertex pointers to some other value, indexed by ID number.
+ *
+ *  This container has the same interface as @ref GraphIteratorMap, but instead of keeping its nodes in a sorted vector it
+ *  stores each node in a table indexed by the key's ID number along with a bit that indicates whether that slot is
+ *  occupied. Since graph ID numbers are dense, insertion, lookup, and erasure are constant time operations, and iteration is
+ *  in order of key ID number. The trade-off is that the memory used by this container is proportional to the largest ID number
+ *  that has been inserted rather than the number of nodes, and iteration must skip over unoccupied slots. Therefore, this
+ *  container is most appropriate when a large fraction of a graph's edges or vertices will be keys. The value type must be
+ *  default constructible.
+ *
+ *  All iterators in this container must belong to the same graph, and only valid iterators (not end iterators) may be
+ *  stored.
+ *
+ *  Since ID numbers are not stable over erasure, this container must be notified whenever edges or vertices (whichever are
+ *  stored by this container), are removed from the graph, even if the items removed from the graph are not the same ones as
+ *  what are stored in this container. */
+template<class K, class V>
+class GraphDenseIteratorMap {
+public:
+    typedef K Key;                                      /**< Graph edge or vertex iterator used as keys. */
+    typedef V Value;                                    /**< Type of value associated with each key. */
+
+    /** The data stored at each node of the map. */
+    class Node {
+        Key key_;                                       /**< Key is the graph edge or vertex iterator. */
+        Value value_;                                   /**< User defined value associated with each key. */
+    public:
+        /** Default constructor. */
+        Node() {}
+
+        /** Constructor. */
+        Node(const Key &key, const Value &value)
+            : key_(key), value_(value) {}
+
+        /** Access the key of this node.
+         *
+         *  Keys are read-only since they're used to index the container. */
+        const Key& key() const { return key_; }
+
+        /** Access the value of this node.
+         *
+         * @{ */
+        Value& value() { return value_; }
+        const Value& value() const { return value_; }
+        /** @} */
+    };
+
+private:
+    // These members are mutable so that we can delay the re-indexing until the last possible minute while still appearing to
+    // have a const-correct interface.
+    mutable std::vector<Node> items_;                   // nodes indexed by the ID numbers of their keys
+    mutable std::vector<bool> present_;                 // whether the corresponding items_ slot is occupied
+    mutable size_t nItems_;                             // number of occupied slots
+    mutable bool needsUpdate_;                          // true if items_ are possibly not at their ID numbers
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Iterators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    // Visits occupied slots in order of ID number. Derived classes choose what part of the node is returned.
+    template<class Derived, class Value, class Map>
+    class BidirectionalIterator: public boost::iterator_facade<Derived, Value, boost::bidirectional_traversal_tag> {
+    protected:
+        Map *map_;
+        size_t idx_;
+        BidirectionalIterator(): map_(NULL), idx_(0) {}
+        BidirectionalIterator(Map *map, size_t idx): map_(map), idx_(idx) {}
+    public:
+        /** Container to which this iterator points. */
+        Map* map() const { return map_; }
+
+        /** Index of the slot to which this iterator points. */
+        size_t index() const { return idx_; }
+    private:
+        friend class boost::iterator_core_access;
+        template<class OtherIter>
+        bool equal(const OtherIter &other) const { return map_ == other.map() && idx_ == other.index(); }
+        void increment() { idx_ = map_->nextOccupied(idx_ + 1); }
+        void decrement() { idx_ = map_->previousOccupied(idx_); }
+    };
+
+public:
+    /** Bidirectional iterator over key/value nodes.
+     *
+     *  Dereferencing this iterator will return a Node from which both the key and the value can be obtained. Node iterators
+     *  are implicitly convertible to both key and value iterators. */
+    class NodeIterator: public BidirectionalIterator<NodeIterator, Node, const GraphDenseIteratorMap> {
+        typedef                BidirectionalIterator<NodeIterator, Node, const GraphDenseIteratorMap> Super;
+    public:
+        NodeIterator() {}
+    private:
+        friend class GraphDenseIteratorMap;
+        friend class boost::iterator_core_access;
+        NodeIterator(const GraphDenseIteratorMap *map, size_t idx): Super(map, idx) {}
+        Node& dereference() const { return this->map_->items_[this->idx_]; }
+    };
+
+    /** Bidirectional iterator over constant key/value nodes.
+     *
+     *  Dereferencing this iterator will return a const Node from which both the key and the value can be obtained. Node
+     *  iterators are implicitly convertible to both key and value iterators. */
+    class ConstNodeIterator: public BidirectionalIterator<ConstNodeIterator, const Node, const GraphDenseIteratorMap> {
+        typedef                     BidirectionalIterator<ConstNodeIterator, const Node, const GraphDenseIteratorMap> Super;
+    public:
+        ConstNodeIterator() {}
+
+        /** Copy constructor. */
+        ConstNodeIterator(const NodeIterator &other)    // implicit
+            : Super(other.map(), other.index()) {}
+    private:
+        friend class GraphDenseIteratorMap;
+        friend class boost::iterator_core_access;
+        ConstNodeIterator(const GraphDenseIteratorMap *map, size_t idx): Super(map, idx) {}
+        const Node& dereference() const { return this->map_->items_[this->idx_]; }
+    };
+
+    /** Bidirectional iterator over keys.
+     *
+     *  Dereferencing this iterator will return a reference to a const key. Keys cannot be altered while they are a member of
+     *  this container. */
+    class ConstKeyIterator: public BidirectionalIterator<ConstKeyIterator, const Key, const GraphDenseIteratorMap> {
+        typedef                    BidirectionalIterator<ConstKeyIterator, const Key, const GraphDenseIteratorMap> Super;
+    public:
+        ConstKeyIterator() {}
+
+        /** Copy constructor. */
+        ConstKeyIterator(const NodeIterator &other)     // implicit
+            : Super(other.map(), other.index()) {}
+
+        /** Copy constructor. */
+        ConstKeyIterator(const ConstNodeIterator &other) // implicit
+            : Super(other.map(), other.index()) {}
+    private:
+        friend class boost::iterator_core_access;
+        const Key& dereference() const { return this->map_->items_[this->idx_].key(); }
+    };
+
+    /** Bidirectional iterator over values.
+     *
+     *  Dereferencing this iterator will return a reference to the user-defined value of the node. Values may be altered in
+     *  place while they are members of a container. */
+    class ValueIterator: public BidirectionalIterator<ValueIterator, Value, const GraphDenseIteratorMap> {
+        typedef                 BidirectionalIterator<ValueIterator, Value, const GraphDenseIteratorMap> Super;
+    public:
+        ValueIterator() {}
+
+        /** Copy constructor. */
+        ValueIterator(const NodeIterator &other)        // implicit
+            : Super(other.map(), other.index()) {}
+    private:
+        friend class boost::iterator_core_access;
+        Value& dereference() const { return this->map_->items_[this->idx_].value(); }
+    };
+
+    /** Bidirectional iterator over values.
+     *
+     *  Dereferencing this iterator will return a reference to the user-defined value of the node. */
+    class ConstValueIterator: public BidirectionalIterator<ConstValueIterator, const Value, const GraphDenseIteratorMap> {
+        typedef                      BidirectionalIterator<ConstValueIterator, const Value, const GraphDenseIteratorMap> Super;
+    public:
+        ConstValueIterator() {}
+
+        /** Copy constructor. */
+        ConstValueIterator(const ValueIterator &other)  // implicit
+            : Super(other.map(), other.index()) {}
+
+        /** Copy constructor. */
+        ConstValueIterator(const ConstNodeIterator &other) // implicit
+            : Super(other.map(), other.index()) {}
+
+        /** Copy constructor. */
+        ConstValueIterator(const NodeIterator &other)   // implicit
+            : Super(other.map(), other.index()) {}
+    private:
+        friend class boost::iterator_core_access;
+        const Value& dereference() const { return this->map_->items_[this->idx_].value(); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Default construct an empty map. */
+    GraphDenseIteratorMap()
+        : nItems_(0), needsUpdate_(false) {}
+
+    /** Construct an empty map with preallocated space.
+     *
+     *  Space is preallocated for ID numbers less than @p nIds, which is typically the number of vertices or edges in the
+     *  graph. */
+    explicit GraphDenseIteratorMap(size_t nIds)
+        : nItems_(0), needsUpdate_(false) {
+        items_.reserve(nIds);
+        present_.reserve(nIds);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Mutators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Indicate that an update is necessary due to erasures.
+     *
+     *  If the graph whose iterators are stored in this container has any edges or vertices that are erased (whichever type
+     *  are stored in this container), then this function should be called to tell the container that the ID numbers of its
+     *  contained iterators have possibly changed.
+     *
+     *  The actual re-indexing of this container will be delayed as long as possible, but logically the user can assume that
+     *  it occurs immediately. */
+    void updateIdNumbers() {
+        needsUpdate_ = true;
+    }
+
+    /** Insert the specified edge or vertex associated with a value.
+     *
+     *  If the edge or vertex already exists, then its value is changed, otherwise a new edge or vertex with the associated
+     *  value is inserted into the map. Note that this is different behavior than std::map where no new value is inserted if
+     *  the key already exists. */
+    void insert(const Key &item, const Value &value) {
+        update();
+        slot(item) = Node(item, value);
+    }
+
+    /** Insert a value only if its key doesn't already exist.
+     *
+     *  Returns a reference to the value, which should be used immediately. The reference is valid until the next modifying
+     *  operation on this object. */
+    Value& insertMaybe(const Key &item, const Value &value) {
+        update();
+        size_t id = item->id();
+        if (id < present_.size() && present_[id])
+            return items_[id].value();
+        Node &node = slot(item);
+        node = Node(item, value);
+        return node.value();
+    }
+
+    /** Insert a default value if its key doesn't already exist.
+     *
+     *  Returns a reference to the value, which should be used immediately. The reference is value until the next modifying
+     *  operation on this object. */
+    Value& insertMaybeDefault(const Key &item) {
+        return insertMaybe(item, Value());
+    }
+
+    /** Erase the specified key if it exists. */
+    void erase(const Key &item) {
+        update();
+        size_t id = item->id();
+        if (id < present_.size() && present_[id]) {
+            present_[id] = false;
+            items_[id] = Node();
+            --nItems_;
+        }
+    }
+
+    /** Remove all entries from this container.
+     *
+     *  The space allocated for the ID numbers is retained. */
+    void clear() {
+        items_.clear();
+        present_.clear();
+        nItems_ = 0;
+        needsUpdate_ = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Queries
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Does the key exist in the map? */
+    bool exists(const Key &item) const {
+        update();
+        size_t id = item->id();
+        return id < present_.size() && present_[id];
+    }
+
+    /** Find the value associated with a particular key. */
+    Sawyer::Optional<Value> find(const Key &item) const {
+        update();
+        size_t id = item->id();
+        if (id < present_.size() && present_[id]) {
+            return items_[id].value();
+        } else {
+            return Sawyer::Nothing();
+        }
+    }
+
+    /** Return the value associated with an existing key. */
+    Value operator[](const Key &item) const {
+        update();
+        return *find(item);
+    }
+
+    /** True if the map has no nodes. */
+    bool isEmpty() const {
+        return 0 == nItems_;
+    }
+
+    /** Number of nodes in the map. */
+    size_t size() const {
+        return nItems_;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Iteration
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /** Iterators for container nodes.
+     *
+     *  This returns a range of node-iterators that will traverse all nodes (key/value pairs) of this container in order of
+     *  key ID number.
+     *
+     * @{ */
+    boost::iterator_range<NodeIterator> nodes() {
+        update();
+        return boost::iterator_range<NodeIterator>(begin(), end());
+    }
+    boost::iterator_range<ConstNodeIterator> nodes() const {
+        update();
+        return boost::iterator_range<ConstNodeIterator>(begin(), end());
+    }
+    /** @} */
+
+    /** Iterators for container keys.
+     *
+     *  Returns a range of key-iterators that will traverse the keys of this container.
+     *
+     * @{ */
+    boost::iterator_range<ConstKeyIterator> keys() {
+        update();
+        return boost::iterator_range<ConstKeyIterator>(begin(), end());
+    }
+    boost::iterator_range<ConstKeyIterator> keys() const {
+        update();
+        return boost::iterator_range<ConstKeyIterator>(begin(), end());
+    }
+    /** @} */
+
+    /** Iterators for container values.
+     *
+     *  Returns a range of iterators that will traverse the user-defined values of this container.  The values are iterated in
+     *  key order, although the keys are not directly available via these iterators.
+     *
+     * @{ */
+    boost::iterator_range<ValueIterator> values() {
+        update();
+        return boost::iterator_range<ValueIterator>(begin(), end());
+    }
+    boost::iterator_range<ConstValueIterator> values() const {
+        update();
+        return boost::iterator_range<ConstValueIterator>(begin(), end());
+    }
+    /** @} */
+
+    // Undocumented C++-style iterators iterator over the key+value nodes.
+    NodeIterator begin() { update(); return NodeIterator(this, nextOccupied(0)); }
+    ConstNodeIterator begin() const { update(); return ConstNodeIterator(this, nextOccupied(0)); }
+    NodeIterator end() { update(); return NodeIterator(this, items_.size()); }
+    ConstNodeIterator end() const { update(); return ConstNodeIterator(this, items_.size()); }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Internal functions
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    // Index of first occupied slot at or after idx, or items_.size() if none.
+    size_t nextOccupied(size_t idx) const {
+        while (idx < present_.size() && !present_[idx])
+            ++idx;
+        return idx;
+    }
+
+    // Index of the last occupied slot before idx.
+    size_t previousOccupied(size_t idx) const {
+        ASSERT_require(idx > 0);
+        do --idx; while (!present_[idx]);
+        return idx;
+    }
+
+    // Returns the slot for the specified key, marking it occupied.
+    Node& slot(const Key &item) const {
+        size_t id = item->id();
+        if (id >= items_.size()) {
+            items_.resize(id + 1);
+            present_.resize(id + 1, false);
+        }
+        if (!present_[id]) {
+            present_[id] = true;
+            ++nItems_;
+        }
+        return items_[id];
+    }
+
+    void update() const {
+        if (needsUpdate_) {
+            needsUpdate_ = false;
+            std::vector<Node> nodes;
+            nodes.reserve(nItems_);
+            for (size_t i = nextOccupied(0); i < items_.size(); i = nextOccupied(i+1))
+                nodes.push_back(items_[i]);
+            items_.clear();
+            present_.clear();
+            nItems_ = 0;
+            BOOST_FOREACH (const Node &node, nodes)
+                slot(node.key()) = node;
+        }
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
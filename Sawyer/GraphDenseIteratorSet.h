@@ -0,0 +1,236 @@
+#ifndef Sawyer_GraphDenseIteratorSet_H
+#define Sawyer_GraphDenseIteratorSet_H
+
+#include <Sawyer/Graph.h>
+
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+
+namespace Sawyer {
+namespace Container {
+
+/** Set of graph edge or vertex pointers (iterators) indexed by ID number.
+ *
+ *  This container has the same interface as @ref GraphIteratorSet, but instead of keeping its members in a sorted vector it
+ *  stores each member in a table indexed by the member's ID number along with a bit that indicates whether that slot is
+ *  occupied. Since graph ID numbers are dense, insertion, lookup, and erasure are constant time operations, and iteration is
+ *  in order of ID number. The trade-off is that the memory used by this container is proportional to the largest ID number
+ *  that has been inserted rather than the number of members, and iteration must skip over unoccupied slots. Therefore, this
+ *  container is most appropriate when a large fraction of a graph's edges or vertices will be members.
+ *
+ *  All iterators in this container must belong to the same graph, and only valid iterators (not end iterators) may be
+ *  stored. Attempting to insert an iterator with the same ID number as one that already exists is a no-op.
+ *
+ *  Since ID numbers are not stable over erasure, this container must be notified whenever edges or vertices (whichever are
+ *  stored by this container), are removed from the graph, even if the items removed from the graph are not the same ones as
+ *  what are stored in this container. */
+template<class T>
+class GraphDenseIteratorSet {
+public:
+    typedef T Value;                                    /**< Type of values stored in this set. */
+
+private:
+    // These members are mutable so that we can delay the re-indexing until the last possible minute while still appearing to
+    // have a const-correct interface.
+    mutable std::vector<Value> items_;                  // items indexed by their ID numbers
+    mutable std::vector<bool> present_;                 // whether the corresponding items_ slot is occupied
+    mutable size_t nItems_;                             // number of occupied slots
+    mutable size_t lowest_;                             // no occupied slot has an index less than this
+    mutable bool needsUpdate_;                          // true if items_ are possibly not at their ID numbers
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Iterators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Iterates over values in this set in order of ID number. */
+    class ConstIterator: public boost::iterator_facade<ConstIterator, const Value, boost::bidirectional_traversal_tag> {
+        const GraphDenseIteratorSet *set_;
+        size_t idx_;
+    public:
+        ConstIterator(): set_(NULL), idx_(0) {}
+    private:
+        friend class boost::iterator_core_access;
+        friend class GraphDenseIteratorSet;
+        ConstIterator(const GraphDenseIteratorSet *set, size_t idx): set_(set), idx_(idx) {}
+        const Value& dereference() const { return set_->items_[idx_]; }
+        bool equal(const ConstIterator &other) const { return set_ == other.set_ && idx_ == other.idx_; }
+        void increment() { idx_ = set_->nextOccupied(idx_ + 1); }
+        void decrement() { idx_ = set_->previousOccupied(idx_); }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Default construct an empty set. */
+    GraphDenseIteratorSet()
+        : nItems_(0), lowest_(0), needsUpdate_(false) {}
+
+    /** Construct an empty set with preallocated space.
+     *
+     *  Space is preallocated for ID numbers less than @p nIds, which is typically the number of vertices or edges in the
+     *  graph. */
+    explicit GraphDenseIteratorSet(size_t nIds)
+        : nItems_(0), lowest_(0), needsUpdate_(false) {
+        items_.reserve(nIds);
+        present_.reserve(nIds);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Iteration
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Value iterator range.
+     *
+     *  Returns an iterator range that covers all values in the set in order of their ID numbers. */
+    boost::iterator_range<ConstIterator> values() const {
+        update();
+        return boost::iterator_range<ConstIterator>(ConstIterator(this, nextOccupied(lowest_)),
+                                                    ConstIterator(this, items_.size()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Mutators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Indicate that an update is necessary due to erasures.
+     *
+     *  If the graph whose iterators are stored in this container has any edges or vertices that are erased (whichever type
+     *  are stored in this container), then this function should be called to tell the container that the ID numbers of its
+     *  contained iterators have possibly changed.
+     *
+     *  The actual re-indexing of this container will be delayed as long as possible, but logically the user can assume that
+     *  it occurs immediately. */
+    void updateIdNumbers() {
+        needsUpdate_ = true;
+    }
+
+    /** Insert the specified edge or vertex if its ID doesn't exist in this set. */
+    void insert(const Value &item) {
+        update();
+        insertUnique(item);
+    }
+
+    /** Insert multiple edges or vertices. */
+    void insert(const GraphDenseIteratorSet &other) {
+        update();
+        BOOST_FOREACH (const Value &item, other.values())
+            insertUnique(item);
+    }
+
+    /** Insert multiple edges or vertices. */
+    template<class SrcIterator>
+    void insert(const SrcIterator &begin, const SrcIterator &end) {
+        update();
+        for (SrcIterator i = begin; i != end; ++i)
+            insertUnique(*i);
+    }
+
+    /** Remove the edge or vertex if it exists. */
+    void erase(const Value &item) {
+        update();
+        size_t id = item->id();
+        if (id < present_.size() && present_[id]) {
+            present_[id] = false;
+            items_[id] = Value();
+            --nItems_;
+        }
+    }
+
+    /** Removes and returns the least iterator. */
+    Value popFront() {
+        update();
+        ASSERT_forbid(isEmpty());
+        lowest_ = nextOccupied(lowest_);
+        Value retval = items_[lowest_];
+        present_[lowest_] = false;
+        items_[lowest_] = Value();
+        --nItems_;
+        ++lowest_;
+        return retval;
+    }
+
+    /** Remove all edges or vertices from this set.
+     *
+     *  The space allocated for the ID numbers is retained. */
+    void clear() {
+        items_.clear();
+        present_.clear();
+        nItems_ = lowest_ = 0;
+        needsUpdate_ = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Queries
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Does the edge or vertex exist in this container? */
+    bool exists(const Value &item) const {
+        update();
+        size_t id = item->id();
+        return id < present_.size() && present_[id];
+    }
+
+    /** True if container has no edges or vertices. */
+    bool isEmpty() const {
+        return 0 == nItems_;
+    }
+    bool empty() const { return isEmpty(); } // undocumented compatibility
+
+    /** Number of items stored in this set. */
+    size_t size() const {
+        return nItems_;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Internal stuff
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    // Index of first occupied slot at or after idx, or items_.size() if none.
+    size_t nextOccupied(size_t idx) const {
+        while (idx < present_.size() && !present_[idx])
+            ++idx;
+        return idx;
+    }
+
+    // Index of the last occupied slot before idx.
+    size_t previousOccupied(size_t idx) const {
+        ASSERT_require(idx > 0);
+        do --idx; while (!present_[idx]);
+        return idx;
+    }
+
+    void update() const {
+        if (needsUpdate_) {
+            needsUpdate_ = false;
+            std::vector<Value> items;
+            items.reserve(nItems_);
+            for (size_t i = nextOccupied(lowest_); i < items_.size(); i = nextOccupied(i+1))
+                items.push_back(items_[i]);
+            items_.clear();
+            present_.clear();
+            nItems_ = lowest_ = 0;
+            BOOST_FOREACH (const Value &item, items)
+                const_cast<GraphDenseIteratorSet*>(this)->insertUnique(item);
+        }
+    }
+
+    void insertUnique(const Value &item) {
+        size_t id = item->id();
+        if (id >= items_.size()) {
+            items_.resize(id + 1);
+            present_.resize(id + 1, false);
+        }
+        if (!present_[id]) {
+            items_[id] = item;
+            present_[id] = true;
+            ++nItems_;
+            lowest_ = std::min(lowest_, id);
+        }
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
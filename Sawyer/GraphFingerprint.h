@@ -0,0 +1,385 @@
+#ifndef Sawyer_GraphFingerprint_H
+#define Sawyer_GraphFingerprint_H
+
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/Assert.h>
+#include <Sawyer/GraphAlgorithm.h>
+#include <Sawyer/HashMap.h>
+
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/foreach.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+namespace Algorithm {
+
+/** Vertex and edge labels for graph fingerprints.
+ *
+ *  Supplies the hashes of the vertex and edge values that a @ref GraphFingerprint mixes into its result. This class serves as
+ *  both a model for those wishing to hash their own vertex and edge values, and as the default implementation when none is
+ *  provided by the user. The default hashes are all zero, so only the shape of the graph is fingerprinted.
+ *
+ *  The methods may be called from more than one thread at a time. */
+template<class Graph>
+class GraphFingerprintLabels {
+public:
+    /** Hash of a vertex's value.
+     *
+     *  Vertices with different hashes are never considered equivalent. This default implementation always returns zero. */
+    boost::uint64_t vertexHash(const Graph &g, const typename Graph::ConstVertexIterator &vertex) const {
+        SAWYER_ARGUSED(g);                              // Leave formal arg names in declaration because they're important
+        SAWYER_ARGUSED(vertex);                         // documentation for this function.
+        return 0;
+    }
+
+    /** Hash of an edge's value.
+     *
+     *  Edges with different hashes are never considered equivalent. This default implementation always returns zero. */
+    boost::uint64_t edgeHash(const Graph &g, const typename Graph::ConstEdgeIterator &edge) const {
+        SAWYER_ARGUSED(g);
+        SAWYER_ARGUSED(edge);
+        return 0;
+    }
+};
+
+/** Isomorphism-invariant hash of a graph.
+ *
+ *  A fingerprint is a 64-bit hash of a graph that doesn't depend on the vertex or edge ID numbers, so isomorphic graphs always
+ *  have equal fingerprints. Graphs with different fingerprints are certainly not isomorphic, which makes fingerprints a cheap
+ *  filter to apply before running an expensive search such as @ref findIsomorphicSubgraphs. Graphs with equal fingerprints are
+ *  very likely, but not certainly, isomorphic.
+ *
+ *  The fingerprint is computed by iterated vertex color refinement (the one-dimensional Weisfeiler-Leman test):
+ *
+ *  @li Each vertex starts with a color that's a hash of its in-degree, its out-degree, and its vertex label hash.
+ *
+ *  @li In each round, every vertex's new color is a hash of its old color and the multisets of old colors of its successors and
+ *      predecessors, each combined with the label hash of the connecting edge. The vertices are processed in parallel.
+ *
+ *  @li Refinement stops when a round doesn't split any color class, or after @ref Settings::maxIterations rounds.
+ *
+ *  @li The fingerprint is a hash of the number of vertices and edges and the sorted final colors.
+ *
+ *  The vertex and edge label hashes come from a labels functor such as @ref GraphFingerprintLabels. For instance, a control flow
+ *  graph fingerprint might hash each vertex's instruction mnemonics so that only blocks with the same instructions are
+ *  considered equivalent.
+ *
+ *  The fingerprint doesn't keep a reference to the graph and must be recomputed after the graph is modified.
+ *
+ *  @code
+ *  GraphFingerprint fp1(g1), fp2(g2);
+ *  if (fp1 == fp2)
+ *      findIsomorphicSubgraphs(g1, g2, solutionProcessor);
+ *  @endcode
+ *
+ *  @sa @ref GraphFingerprintIndex */
+class GraphFingerprint {
+public:
+    /** Settings for computing a fingerprint. */
+    struct Settings {
+        /** Maximum number of refinement rounds.
+         *
+         *  Most graphs stop refining after a few rounds, but a long chain of vertices needs about half its length. Stopping
+         *  early makes the fingerprint less discriminating but it's still the same for isomorphic graphs. */
+        size_t maxIterations;
+
+        /** Number of threads.
+         *
+         *  Zero means use the hardware concurrency. More than one thread is used only if %Sawyer was compiled with thread
+         *  support. */
+        size_t nThreads;
+
+        Settings()
+            : maxIterations(16), nThreads(0) {}
+    };
+
+private:
+    boost::uint64_t hash_;
+    size_t nVertices_;
+    size_t nEdges_;
+    size_t nIterations_;
+    size_t nColors_;
+    std::vector<boost::uint64_t> colors_;               // final color for each vertex ID
+
+public:
+    /** Fingerprint of an empty graph. */
+    GraphFingerprint()
+        : hash_(combine(0, 0)), nVertices_(0), nEdges_(0), nIterations_(0), nColors_(0) {}
+
+    /** Fingerprint of a graph.
+     *
+     *  The first version fingerprints only the shape of the graph; the second also uses the vertex and edge hashes supplied
+     *  by @p labels.
+     *
+     * @{ */
+    template<class Graph>
+    explicit GraphFingerprint(const Graph &g, const Settings &settings = Settings())
+        : hash_(0), nVertices_(0), nEdges_(0), nIterations_(0), nColors_(0) {
+        build(g, GraphFingerprintLabels<Graph>(), settings);
+    }
+
+    template<class Graph, class Labels>
+    GraphFingerprint(const Graph &g, const Labels &labels, const Settings &settings = Settings())
+        : hash_(0), nVertices_(0), nEdges_(0), nIterations_(0), nColors_(0) {
+        build(g, labels, settings);
+    }
+    /** @} */
+
+    /** Recompute the fingerprint for a graph.
+     *
+     * @{ */
+    template<class Graph>
+    void build(const Graph &g, const Settings &settings = Settings()) {
+        build(g, GraphFingerprintLabels<Graph>(), settings);
+    }
+
+    template<class Graph, class Labels>
+    void build(const Graph &g, const Labels &labels, const Settings &settings = Settings()) {
+        nVertices_ = g.nVertices();
+        nEdges_ = g.nEdges();
+        nIterations_ = 0;
+
+        std::vector<boost::uint64_t> edgeHashes(nEdges_);
+        HashEdges<Graph, Labels> hashEdges(g, labels, edgeHashes);
+        GraphAlgorithmImpl::forEachId(nEdges_, settings.nThreads, hashEdges);
+
+        colors_.resize(nVertices_);
+        InitialColor<Graph, Labels> initialColor(g, labels, colors_);
+        GraphAlgorithmImpl::forEachId(nVertices_, settings.nThreads, initialColor);
+
+        std::vector<boost::uint64_t> sorted;
+        nColors_ = countColors(colors_, sorted);
+        std::vector<boost::uint64_t> next(nVertices_);
+        while (nIterations_ < settings.maxIterations && nColors_ < nVertices_) {
+            Refine<Graph> refine(g, edgeHashes, colors_, next);
+            GraphAlgorithmImpl::forEachId(nVertices_, settings.nThreads, refine);
+            ++nIterations_;
+
+            // Each new color includes the old color, so the new classes are a refinement of the old classes. If their number
+            // didn't change then neither did the classes, and they never will.
+            std::vector<boost::uint64_t> nextSorted;
+            const size_t nColors = countColors(next, nextSorted);
+            colors_.swap(next);
+            sorted.swap(nextSorted);
+            if (nColors == nColors_)
+                break;
+            nColors_ = nColors;
+        }
+
+        hash_ = combine(nVertices_, nEdges_);
+        BOOST_FOREACH (boost::uint64_t color, sorted)
+            hash_ = combine(hash_, color);
+    }
+    /** @} */
+
+    /** The fingerprint hash. */
+    boost::uint64_t hash() const {
+        return hash_;
+    }
+
+    /** Number of vertices in the fingerprinted graph. */
+    size_t nVertices() const {
+        return nVertices_;
+    }
+
+    /** Number of edges in the fingerprinted graph. */
+    size_t nEdges() const {
+        return nEdges_;
+    }
+
+    /** Number of refinement rounds that were run. */
+    size_t nIterations() const {
+        return nIterations_;
+    }
+
+    /** Number of distinct vertex colors after the last round. */
+    size_t nColors() const {
+        return nColors_;
+    }
+
+    /** Final color of a vertex.
+     *
+     *  An isomorphism between two graphs with equal fingerprints can only map a vertex to a vertex of the same color, so the
+     *  colors can also serve as a vertex equivalence predicate for the isomorphism search itself. */
+    boost::uint64_t vertexColor(size_t vertexId) const {
+        ASSERT_require(vertexId < colors_.size());
+        return colors_[vertexId];
+    }
+
+    /** Whether two fingerprints are equal.
+     *
+     *  Isomorphic graphs always have equal fingerprints.
+     *
+     * @{ */
+    bool operator==(const GraphFingerprint &other) const {
+        return hash_ == other.hash_ && nVertices_ == other.nVertices_ && nEdges_ == other.nEdges_;
+    }
+
+    bool operator!=(const GraphFingerprint &other) const {
+        return !(*this == other);
+    }
+    /** @} */
+
+private:
+    static boost::uint64_t mix(boost::uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ull;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    static boost::uint64_t combine(boost::uint64_t a, boost::uint64_t b) {
+        return mix(a * 0x9e3779b97f4a7c15ull + b);
+    }
+
+    // Number of distinct colors, and the colors in sorted order.
+    static size_t countColors(const std::vector<boost::uint64_t> &colors, std::vector<boost::uint64_t> &sorted /*out*/) {
+        sorted = colors;
+        std::sort(sorted.begin(), sorted.end());
+        size_t n = 0;
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            if (0 == i || sorted[i] != sorted[i-1])
+                ++n;
+        }
+        return n;
+    }
+
+    template<class Graph, class Labels>
+    struct HashEdges {
+        const Graph &g;
+        const Labels &labels;
+        std::vector<boost::uint64_t> &hashes;
+
+        HashEdges(const Graph &g, const Labels &labels, std::vector<boost::uint64_t> &hashes)
+            : g(g), labels(labels), hashes(hashes) {}
+
+        void operator()(size_t id) {
+            hashes[id] = labels.edgeHash(g, g.findEdge(id));
+        }
+    };
+
+    template<class Graph, class Labels>
+    struct InitialColor {
+        const Graph &g;
+        const Labels &labels;
+        std::vector<boost::uint64_t> &colors;
+
+        InitialColor(const Graph &g, const Labels &labels, std::vector<boost::uint64_t> &colors)
+            : g(g), labels(labels), colors(colors) {}
+
+        void operator()(size_t id) {
+            typename Graph::ConstVertexIterator vertex = g.findVertex(id);
+            colors[id] = combine(combine(labels.vertexHash(g, vertex), vertex->nInEdges()), vertex->nOutEdges());
+        }
+    };
+
+    // One refinement round for one vertex. Neighbor colors are summed after mixing so that their order doesn't matter, and
+    // successors and predecessors are mixed differently so that edge direction does.
+    template<class Graph>
+    struct Refine {
+        const Graph &g;
+        const std::vector<boost::uint64_t> &edgeHashes, &colors;
+        std::vector<boost::uint64_t> &next;
+
+        Refine(const Graph &g, const std::vector<boost::uint64_t> &edgeHashes, const std::vector<boost::uint64_t> &colors,
+               std::vector<boost::uint64_t> &next)
+            : g(g), edgeHashes(edgeHashes), colors(colors), next(next) {}
+
+        void operator()(size_t id) {
+            typename Graph::ConstVertexIterator vertex = g.findVertex(id);
+            boost::uint64_t successors = 0, predecessors = 0;
+            BOOST_FOREACH (const typename Graph::Edge &edge, vertex->outEdges())
+                successors += mix(combine(colors[edge.target()->id()], edgeHashes[edge.id()]));
+            BOOST_FOREACH (const typename Graph::Edge &edge, vertex->inEdges())
+                predecessors += mix(combine(edgeHashes[edge.id()], colors[edge.source()->id()]));
+            next[id] = combine(combine(colors[id], successors), predecessors);
+        }
+    };
+};
+
+/** Graphs grouped by fingerprint.
+ *
+ *  Stores arbitrary values, such as graph pointers or names, keyed by the fingerprints of their graphs so that the values whose
+ *  graphs might be isomorphic to a given graph are found in constant time. Only the graphs in the same group need to be
+ *  compared with an isomorphism search.
+ *
+ *  @code
+ *  GraphFingerprintIndex<size_t> index;
+ *  for (size_t i = 0; i < graphs.size(); ++i)
+ *      index.insert(GraphFingerprint(graphs[i]), i);
+ *  BOOST_FOREACH (const std::vector<size_t> &group, index.groups()) {
+ *      // graphs in the group are probably isomorphic to each other
+ *  }
+ *  @endcode */
+template<class T>
+class GraphFingerprintIndex {
+public:
+    typedef T Value;                                    /**< Type of values stored in the index. */
+    typedef std::vector<Value> Group;                   /**< Values whose graphs have the same fingerprint. */
+
+private:
+    typedef HashMap<boost::uint64_t, Group> Map;
+    Map map_;
+    size_t size_;
+
+public:
+    /** Construct an empty index. */
+    GraphFingerprintIndex()
+        : size_(0) {}
+
+    /** Number of values in the index. */
+    size_t size() const {
+        return size_;
+    }
+
+    /** Number of distinct fingerprints in the index. */
+    size_t nGroups() const {
+        return map_.size();
+    }
+
+    /** Whether the index is empty. */
+    bool isEmpty() const {
+        return 0 == size_;
+    }
+
+    /** Add a value to the index.
+     *
+     *  The value is added to the group for the specified fingerprint. A value can be inserted more than once. */
+    GraphFingerprintIndex& insert(const GraphFingerprint &fingerprint, const Value &value) {
+        map_.insertMaybeDefault(fingerprint.hash()).push_back(value);
+        ++size_;
+        return *this;
+    }
+
+    /** Values whose graphs have the specified fingerprint.
+     *
+     *  Returns the values in the order they were inserted, or an empty group if there are none. */
+    const Group& find(const GraphFingerprint &fingerprint) const {
+        static const Group empty;
+        typename Map::ConstNodeIterator found = map_.find(fingerprint.hash());
+        return found == map_.nodes().end() ? empty : found->value();
+    }
+
+    /** All groups.
+     *
+     *  Returns the groups in no particular order. Each group is non-empty. */
+    boost::iterator_range<typename Map::ConstValueIterator> groups() const {
+        return map_.values();
+    }
+
+    /** Remove all values. */
+    void clear() {
+        map_.clear();
+        size_ = 0;
+    }
+};
+
+} // namespace
+} // namespace
+} // namespace
+
+#endif
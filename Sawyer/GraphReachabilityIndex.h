@@ -0,0 +1,521 @@
+#ifndef Sawyer_GraphReachabilityIndex_H
+#define Sawyer_GraphReachabilityIndex_H
+
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/Assert.h>
+#include <Sawyer/GraphAlgorithm.h>
+
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/foreach.hpp>
+#include <boost/unordered_set.hpp>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+namespace Algorithm {
+
+/** Precomputed answers to reachability queries.
+ *
+ *  Answers whether one vertex of a graph can reach another by following edges in their forward direction. The index is built
+ *  once from a graph and can then answer many queries, usually in constant time, which is much faster than running a new
+ *  graph traversal for each question. Queries are const and may be asked from many threads at once.
+ *
+ *  The index is built in these steps:
+ *
+ *  @li The strongly connected components are found and condensed into single vertices of a directed acyclic graph. All
+ *      vertices of a component reach each other.
+ *
+ *  @li If the full transitive closure of the condensed graph fits in @ref Settings::maxClosureBytes then it's stored as a
+ *      triangular bit matrix and every query is a single bit lookup.
+ *
+ *  @li Otherwise, the condensed graph is labeled with @ref Settings::nLabelings randomized depth-first post-order interval
+ *      labelings in the style of GRAIL. Each labeling's spanning forest intervals prove reachability for descendants in that
+ *      spanning forest, and the intervals of all labelings together prove unreachability for most other pairs. A query
+ *      that's not answered by the labels falls back to a depth-first search of the condensed graph that's pruned by those same
+ *      labels.
+ *
+ *  The index refers to vertices by their ID numbers and doesn't keep a reference to the graph. Since vertex ID numbers and
+ *  edges change when a graph is modified, the index must be rebuilt after any modification.
+ *
+ *  @code
+ *  GraphReachabilityIndex index(cfg);
+ *  if (index.reaches(entry->id(), vertex->id()))
+ *      ...
+ *  @endcode */
+class GraphReachabilityIndex {
+public:
+    /** Settings that trade memory for query time. */
+    struct Settings {
+        /** Maximum bytes for the transitive closure.
+         *
+         *  The closure of the condensed graph needs about <em>n</em><sup>2</sup>/16 bytes where @em n is the number of strongly
+         *  connected components. If it needs more than this limit then labels are used instead. Zero disables the closure. */
+        size_t maxClosureBytes;
+
+        /** Number of interval labelings.
+         *
+         *  Each labeling needs three words per strongly connected component. More labelings answer more queries without falling
+         *  back to a search. Zero means every query not answered by the closure is answered by a search. */
+        size_t nLabelings;
+
+        /** Number of threads used to build the index.
+         *
+         *  Zero means use the hardware concurrency. More than one thread is used only if %Sawyer was compiled with thread
+         *  support. */
+        size_t nThreads;
+
+        Settings()
+            : maxClosureBytes(16 * 1024 * 1024), nLabelings(3), nThreads(0) {}
+    };
+
+private:
+    // Intervals for one component in one labeling. A component reaches only components whose [low, post] interval is within its
+    // own, and it reaches all components whose post-order number is within its [treeLow, post] spanning tree interval.
+    struct Label {
+        size_t low;                                     // least post-order number of any reachable component
+        size_t treeLow;                                 // least post-order number in this component's spanning tree
+        size_t post;                                    // post-order number of this component
+    };
+
+    Settings settings_;
+    std::vector<size_t> components_;                    // component number for each vertex ID
+    size_t nComponents_;                                // components are numbered so edges go from higher to lower numbers
+    std::vector<size_t> dagOffsets_;                    // successors of component c are dagSuccessors_[dagOffsets_[c] ...]
+    std::vector<size_t> dagSuccessors_;                 // successor components, sorted and without self edges
+    std::vector<boost::uint64_t> closure_;              // row c holds bits 0 through c for the components reachable from c
+    size_t nBuiltLabelings_;                            // number of labelings in labels_, which might differ from the settings
+    std::vector<Label> labels_;                         // labels for component c are labels_[c * nBuiltLabelings_ ...]
+
+public:
+    /** Construct an empty index.
+     *
+     *  An empty index has no vertices and cannot be queried. */
+    GraphReachabilityIndex()
+        : nComponents_(0), nBuiltLabelings_(0) {}
+
+    /** Construct an index for a graph. */
+    template<class Graph>
+    explicit GraphReachabilityIndex(const Graph &g, const Settings &settings = Settings())
+        : settings_(settings), nComponents_(0), nBuiltLabelings_(0) {
+        build(g);
+    }
+
+    /** Rebuild the index for a graph.
+     *
+     *  The index is rebuilt from scratch using this index's settings. */
+    template<class Graph>
+    void build(const Graph &g) {
+        std::vector<size_t> offsets, targets;
+        successorLists(g, offsets, targets);
+        findComponents(offsets, targets);
+        condense(offsets, targets);
+        offsets = std::vector<size_t>();
+        targets = std::vector<size_t>();
+
+        closure_.clear();
+        labels_.clear();
+        nBuiltLabelings_ = 0;
+        if (nComponents_ > 0 && closureWords(nComponents_) * sizeof(boost::uint64_t) <= settings_.maxClosureBytes) {
+            buildClosure();
+        } else {
+            buildLabels();
+        }
+    }
+
+    /** Property: Settings.
+     *
+     *  Changing the settings has no effect until the index is rebuilt.
+     *
+     * @{ */
+    const Settings& settings() const { return settings_; }
+    void settings(const Settings &s) { settings_ = s; }
+    /** @} */
+
+    /** Number of vertices indexed. */
+    size_t nVertices() const {
+        return components_.size();
+    }
+
+    /** Number of strongly connected components. */
+    size_t nComponents() const {
+        return nComponents_;
+    }
+
+    /** Strongly connected component for a vertex.
+     *
+     *  Components are numbered from zero in reverse topological order: every edge between two different components goes from a
+     *  higher numbered component to a lower numbered component. */
+    size_t componentId(size_t vertexId) const {
+        ASSERT_require(vertexId < components_.size());
+        return components_[vertexId];
+    }
+
+    /** Whether the transitive closure is stored.
+     *
+     *  If true, every query is answered by a single bit lookup. */
+    bool hasClosure() const {
+        return !closure_.empty();
+    }
+
+    /** Approximate number of bytes used by the index. */
+    size_t nBytes() const {
+        return sizeof(*this) + (components_.capacity() + dagOffsets_.capacity() + dagSuccessors_.capacity()) * sizeof(size_t) +
+            closure_.capacity() * sizeof(boost::uint64_t) + labels_.capacity() * sizeof(Label);
+    }
+
+    /** Whether one vertex can reach another.
+     *
+     *  Returns true if there's a path from the vertex with ID @p sourceId to the vertex with ID @p targetId that follows edges in
+     *  their forward direction. Every vertex reaches itself. */
+    bool reaches(size_t sourceId, size_t targetId) const {
+        ASSERT_require(sourceId < components_.size());
+        ASSERT_require(targetId < components_.size());
+        return componentReaches(components_[sourceId], components_[targetId]);
+    }
+
+    /** Whether one strongly connected component can reach another.
+     *
+     *  Components are identified by the numbers returned by @ref componentId. Every component reaches itself. */
+    bool componentReaches(size_t source, size_t target) const {
+        ASSERT_require(source < nComponents_);
+        ASSERT_require(target < nComponents_);
+        if (source == target)
+            return true;
+        if (source < target)
+            return false;
+        if (!closure_.empty())
+            return closureBit(source, target);
+
+        switch (test(source, target)) {
+            case YES: return true;
+            case NO: return false;
+            case MAYBE: break;
+        }
+
+        // Depth-first search of the condensed graph, skipping components that the labels say can't reach the target. Successors
+        // are sorted, and they're pushed from highest to lowest so that the search continues from the successor that's closest
+        // to the target in topological order. Successors lower than the target can't reach it.
+        std::vector<size_t> worklist(1, source);
+        boost::unordered_set<size_t> seen;
+        while (!worklist.empty()) {
+            size_t c = worklist.back();
+            worklist.pop_back();
+            for (size_t i = dagOffsets_[c+1]; i > dagOffsets_[c]; --i) {
+                size_t s = dagSuccessors_[i-1];
+                if (s <= target) {
+                    if (s == target)
+                        return true;
+                    break;
+                }
+                switch (test(s, target)) {
+                    case YES:
+                        return true;
+                    case NO:
+                        break;
+                    case MAYBE:
+                        if (seen.insert(s).second)
+                            worklist.push_back(s);
+                        break;
+                }
+            }
+        }
+        return false;
+    }
+
+private:
+    enum Answer { NO, YES, MAYBE };
+
+    // What the labels say about whether one component reaches another different component.
+    Answer test(size_t source, size_t target) const {
+        if (source < target)
+            return NO;
+        const size_t k = nBuiltLabelings_;
+        if (0 == k)
+            return MAYBE;
+        const Label *s = &labels_[source * k], *t = &labels_[target * k];
+        Answer answer = MAYBE;
+        for (size_t i = 0; i < k; ++i) {
+            if (t[i].low < s[i].low || t[i].post > s[i].post)
+                return NO;
+            if (s[i].treeLow <= t[i].post)
+                answer = YES;
+        }
+        return answer;
+    }
+
+    //-------------------------------------------------------------------------------------------------------------------------
+    // Building
+    //-------------------------------------------------------------------------------------------------------------------------
+
+    // Fills in the successor vertex IDs of one vertex.
+    template<class Graph>
+    struct FillSuccessors {
+        const Graph &g;
+        const std::vector<size_t> &offsets;
+        std::vector<size_t> &targets;
+
+        FillSuccessors(const Graph &g, const std::vector<size_t> &offsets, std::vector<size_t> &targets)
+            : g(g), offsets(offsets), targets(targets) {}
+
+        void operator()(size_t id) {
+            size_t i = offsets[id];
+            BOOST_FOREACH (const typename Graph::Edge &edge, g.findVertex(id)->outEdges())
+                targets[i++] = edge.target()->id();
+        }
+    };
+
+    // Copies the graph's edges into compressed sparse row form so that the remaining steps don't depend on the graph type.
+    template<class Graph>
+    void successorLists(const Graph &g, std::vector<size_t> &offsets, std::vector<size_t> &targets) {
+        offsets.resize(g.nVertices() + 1);
+        offsets[0] = 0;
+        for (size_t id = 0; id < g.nVertices(); ++id)
+            offsets[id+1] = offsets[id] + g.findVertex(id)->nOutEdges();
+        targets.resize(offsets.back());
+        FillSuccessors<Graph> fill(g, offsets, targets);
+        GraphAlgorithmImpl::forEachId(g.nVertices(), settings_.nThreads, fill);
+    }
+
+    // Tarjan's algorithm without recursion. Components are numbered in the order they're completed, which is a reverse
+    // topological order of the condensed graph.
+    void findComponents(const std::vector<size_t> &offsets, const std::vector<size_t> &targets) {
+        static const size_t NOT_FOUND(-1);
+        const size_t n = offsets.size() - 1;
+        std::vector<size_t> order(n, NOT_FOUND), low(n);
+        std::vector<bool> onStack(n, false);
+        std::vector<size_t> stack;
+        std::vector<std::pair<size_t, size_t> > callStack; // vertex and index of its next edge
+        size_t nVisited = 0;
+
+        components_.clear();
+        components_.resize(n, NOT_FOUND);
+        nComponents_ = 0;
+
+        for (size_t root = 0; root < n; ++root) {
+            if (order[root] != NOT_FOUND)
+                continue;
+            order[root] = low[root] = nVisited++;
+            stack.push_back(root);
+            onStack[root] = true;
+            callStack.push_back(std::make_pair(root, offsets[root]));
+
+            while (!callStack.empty()) {
+                const size_t v = callStack.back().first;
+                if (callStack.back().second < offsets[v+1]) {
+                    const size_t w = targets[callStack.back().second++];
+                    if (order[w] == NOT_FOUND) {
+                        order[w] = low[w] = nVisited++;
+                        stack.push_back(w);
+                        onStack[w] = true;
+                        callStack.push_back(std::make_pair(w, offsets[w]));
+                    } else if (onStack[w]) {
+                        low[v] = std::min(low[v], order[w]);
+                    }
+                } else {
+                    callStack.pop_back();
+                    if (!callStack.empty()) {
+                        size_t &parentLow = low[callStack.back().first];
+                        parentLow = std::min(parentLow, low[v]);
+                    }
+                    if (low[v] == order[v]) {
+                        size_t w;
+                        do {
+                            w = stack.back();
+                            stack.pop_back();
+                            onStack[w] = false;
+                            components_[w] = nComponents_;
+                        } while (w != v);
+                        ++nComponents_;
+                    }
+                }
+            }
+        }
+    }
+
+    // Finds the distinct successor components of one component. The results are written over the component's portion of the
+    // scratch array, which is large enough to hold one successor per edge of its members.
+    struct FindDagSuccessors {
+        const std::vector<size_t> &components, &members, &memberOffsets, &offsets, &targets, &scratchOffsets;
+        std::vector<size_t> &scratch, &nSuccessors;
+
+        FindDagSuccessors(const std::vector<size_t> &components, const std::vector<size_t> &members,
+                          const std::vector<size_t> &memberOffsets, const std::vector<size_t> &offsets,
+                          const std::vector<size_t> &targets, const std::vector<size_t> &scratchOffsets,
+                          std::vector<size_t> &scratch, std::vector<size_t> &nSuccessors)
+            : components(components), members(members), memberOffsets(memberOffsets), offsets(offsets), targets(targets),
+              scratchOffsets(scratchOffsets), scratch(scratch), nSuccessors(nSuccessors) {}
+
+        void operator()(size_t c) {
+            std::vector<size_t>::iterator begin = scratch.begin() + scratchOffsets[c], end = begin;
+            for (size_t i = memberOffsets[c]; i < memberOffsets[c+1]; ++i) {
+                const size_t v = members[i];
+                for (size_t j = offsets[v]; j < offsets[v+1]; ++j) {
+                    if (components[targets[j]] != c)
+                        *end++ = components[targets[j]];
+                }
+            }
+            std::sort(begin, end);
+            nSuccessors[c] = std::unique(begin, end) - begin;
+        }
+    };
+
+    // Builds the condensed graph whose vertices are the strongly connected components.
+    void condense(const std::vector<size_t> &offsets, const std::vector<size_t> &targets) {
+        const size_t n = components_.size();
+
+        // Members of each component, and room for the successors of all members
+        std::vector<size_t> memberOffsets(nComponents_ + 1, 0), scratchOffsets(nComponents_ + 1, 0);
+        for (size_t v = 0; v < n; ++v) {
+            ++memberOffsets[components_[v] + 1];
+            scratchOffsets[components_[v] + 1] += offsets[v+1] - offsets[v];
+        }
+        for (size_t c = 0; c < nComponents_; ++c) {
+            memberOffsets[c+1] += memberOffsets[c];
+            scratchOffsets[c+1] += scratchOffsets[c];
+        }
+        std::vector<size_t> members(n), next(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (size_t v = 0; v < n; ++v)
+            members[next[components_[v]]++] = v;
+
+        std::vector<size_t> scratch(scratchOffsets.back()), nSuccessors(nComponents_);
+        FindDagSuccessors find(components_, members, memberOffsets, offsets, targets, scratchOffsets, scratch, nSuccessors);
+        GraphAlgorithmImpl::forEachId(nComponents_, settings_.nThreads, find, 1024);
+
+        dagOffsets_.resize(nComponents_ + 1);
+        dagOffsets_[0] = 0;
+        for (size_t c = 0; c < nComponents_; ++c)
+            dagOffsets_[c+1] = dagOffsets_[c] + nSuccessors[c];
+        dagSuccessors_.resize(dagOffsets_.back());
+        for (size_t c = 0; c < nComponents_; ++c) {
+            std::copy(scratch.begin() + scratchOffsets[c], scratch.begin() + scratchOffsets[c] + nSuccessors[c],
+                      dagSuccessors_.begin() + dagOffsets_[c]);
+        }
+    }
+
+    // Number of 64-bit words in the first n rows of the triangular closure. Row c holds bits 0 through c.
+    static size_t closureWords(size_t n) {
+        const size_t q = n / 64, r = n % 64;
+        return n + 32 * q * (q - (q > 0 ? 1 : 0)) + q * r;
+    }
+
+    bool closureBit(size_t source, size_t target) const {
+        return (closure_[closureWords(source) + target / 64] >> (target % 64)) & 1;
+    }
+
+    // Computes one row of the closure from the rows of its successors, which have all been computed already.
+    struct ClosureRow {
+        GraphReachabilityIndex &self;
+        const std::vector<size_t> &level;
+
+        ClosureRow(GraphReachabilityIndex &self, const std::vector<size_t> &level)
+            : self(self), level(level) {}
+
+        void operator()(size_t i) {
+            const size_t c = level[i];
+            boost::uint64_t *row = &self.closure_[closureWords(c)];
+            row[c / 64] |= boost::uint64_t(1) << (c % 64);
+            for (size_t j = self.dagOffsets_[c]; j < self.dagOffsets_[c+1]; ++j) {
+                const size_t s = self.dagSuccessors_[j];
+                const boost::uint64_t *other = &self.closure_[closureWords(s)];
+                for (size_t w = 0; w <= s / 64; ++w)
+                    row[w] |= other[w];
+            }
+        }
+    };
+
+    // Computes the closure one level at a time, where a component's level is the length of the longest path from it to a sink.
+    // All components on one level can be computed in parallel.
+    void buildClosure() {
+        std::vector<size_t> heights(nComponents_, 0);
+        size_t nLevels = 0;
+        for (size_t c = 0; c < nComponents_; ++c) {
+            for (size_t i = dagOffsets_[c]; i < dagOffsets_[c+1]; ++i)
+                heights[c] = std::max(heights[c], heights[dagSuccessors_[i]] + 1);
+            nLevels = std::max(nLevels, heights[c] + 1);
+        }
+        std::vector<std::vector<size_t> > levels(nLevels);
+        for (size_t c = 0; c < nComponents_; ++c)
+            levels[heights[c]].push_back(c);
+
+        closure_.resize(closureWords(nComponents_), 0);
+        BOOST_FOREACH (const std::vector<size_t> &level, levels) {
+            ClosureRow row(*this, level);
+            GraphAlgorithmImpl::forEachId(level.size(), settings_.nThreads, row, 64);
+        }
+    }
+
+    // Computes one randomized depth-first labeling. The first labeling visits components and edges in their natural order; the
+    // others rotate each list by a pseudo-random amount. A component's spanning tree is numbered from the number of components
+    // finished when it's discovered through its own post-order number.
+    struct Labeling {
+        GraphReachabilityIndex &self;
+
+        explicit Labeling(GraphReachabilityIndex &self)
+            : self(self) {}
+
+        static size_t rotation(size_t c, size_t labeling, size_t n) {
+            boost::uint64_t x = (boost::uint64_t(c) + 1) * 0x9e3779b97f4a7c15ull ^ (boost::uint64_t(labeling) << 32);
+            x ^= x >> 29;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 32;
+            return labeling == 0 || n == 0 ? 0 : x % n;
+        }
+
+        void operator()(size_t labeling) {
+            const size_t n = self.nComponents_, k = self.nBuiltLabelings_;
+            std::vector<bool> visited(n, false);
+            std::vector<std::pair<size_t, size_t> > stack; // component and number of its successors examined so far
+            size_t nFinished = 0;
+
+            // Every depth-first order is a valid labeling. Starting from higher numbered components tends to start from the
+            // sources of the condensed graph, which gives larger spanning trees.
+            const size_t startRotation = rotation(n, labeling, n);
+            for (size_t i = 0; i < n; ++i) {
+                const size_t root = n - 1 - (i + startRotation) % n;
+                if (visited[root])
+                    continue;
+                visited[root] = true;
+                stack.push_back(std::make_pair(root, 0));
+                self.labels_[root * k + labeling].treeLow = nFinished;
+
+                while (!stack.empty()) {
+                    const size_t c = stack.back().first;
+                    const size_t begin = self.dagOffsets_[c], degree = self.dagOffsets_[c+1] - begin;
+                    if (stack.back().second < degree) {
+                        const size_t j = (stack.back().second++ + rotation(c, labeling, degree)) % degree;
+                        const size_t s = self.dagSuccessors_[begin + j];
+                        if (!visited[s]) {
+                            visited[s] = true;
+                            stack.push_back(std::make_pair(s, 0));
+                            self.labels_[s * k + labeling].treeLow = nFinished;
+                        }
+                    } else {
+                        stack.pop_back();
+                        Label &label = self.labels_[c * k + labeling];
+                        label.post = nFinished++;
+                        label.low = label.post;
+                        for (size_t j = begin; j < begin + degree; ++j)
+                            label.low = std::min(label.low, self.labels_[self.dagSuccessors_[j] * k + labeling].low);
+                    }
+                }
+            }
+        }
+    };
+
+    void buildLabels() {
+        const size_t k = settings_.nLabelings;
+        if (0 == k)
+            return;
+        nBuiltLabelings_ = k;
+        labels_.resize(nComponents_ * k);
+        Labeling labeling(*this);
+        GraphAlgorithmImpl::forEachId(k, settings_.nThreads, labeling, 1);
+    }
+};
+
+} // namespace
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,393 @@
+#ifndef Sawyer_HashedDistinctList_H
+#define Sawyer_HashedDistinctList_H
+
+#include <Sawyer/Sawyer.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/foreach.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+
+/** A doubly-linked list of distinct items stored in a hash table.
+ *
+ *  This container has the same semantics as @ref DistinctList, but each item is stored only once: the list links are
+ *  embedded in the slots of an open-addressing hash table that's keyed by the item. Therefore, insertion, erasure, and
+ *  existence tests take constant expected time, and the whole container is one contiguous array.  Like @ref DistinctList, it
+ *  is well suited for work lists where an item should not be added if it's already pending.
+ *
+ *  Items must be default constructible, copyable, hashable by @p H, and comparable for equality by @p Eq. Iterators and
+ *  references are invalidated by any operation that inserts or erases items. */
+template<class T, class H = boost::hash<T>, class Eq = std::equal_to<T> >
+class HashedDistinctList {
+public:
+    typedef T Item;                                     /**< Type of items stored in the list. */
+    typedef H Hasher;                                   /**< Functor for hashing items. */
+    typedef Eq Equality;                                /**< Functor for comparing items for equality. */
+
+private:
+    static const size_t NIL = (size_t)(-1);
+
+    // A slot of the hash table. Occupied slots are linked into a list in item order.
+    struct Slot {
+        Item item;
+        size_t hash;                                    // hash of item, to avoid recomputing it when moving slots
+        size_t prev, next;                              // slot indexes of neighboring items, or NIL
+        bool occupied;
+        Slot(): hash(0), prev(NIL), next(NIL), occupied(false) {}
+    };
+
+    std::vector<Slot> slots_;                           // size is zero or a power of two
+    size_t head_, tail_;                                // first and last items of the list, or NIL
+    size_t size_;                                       // number of occupied slots
+    Hasher hasher_;
+    Equality equal_;
+
+public:
+    /** Bidirectional iterator over items in list order. */
+    class ConstIterator: public boost::iterator_facade<ConstIterator, const Item, boost::bidirectional_traversal_tag> {
+        const HashedDistinctList *list_;
+        size_t idx_;
+    public:
+        ConstIterator(): list_(NULL), idx_(NIL) {}
+    private:
+        friend class boost::iterator_core_access;
+        friend class HashedDistinctList;
+        ConstIterator(const HashedDistinctList *list, size_t idx): list_(list), idx_(idx) {}
+        const Item& dereference() const { return list_->slots_[idx_].item; }
+        bool equal(const ConstIterator &other) const { return list_ == other.list_ && idx_ == other.idx_; }
+        void increment() { idx_ = list_->slots_[idx_].next; }
+        void decrement() { idx_ = NIL == idx_ ? list_->tail_ : list_->slots_[idx_].prev; }
+    };
+
+public:
+    /** Construct an empty list. */
+    HashedDistinctList()
+        : head_(NIL), tail_(NIL), size_(0) {}
+
+    /** Copy-construct a list. */
+    template<class T2, class H2, class Eq2>
+    HashedDistinctList(const HashedDistinctList<T2, H2, Eq2> &other)
+        : head_(NIL), tail_(NIL), size_(0) {
+        reserve(other.size());
+        BOOST_FOREACH (const T2 &item, other.values())
+            pushBack(item);
+    }
+
+    /** Assign one list to another. */
+    template<class T2, class H2, class Eq2>
+    HashedDistinctList& operator=(const HashedDistinctList<T2, H2, Eq2> &other) {
+        if ((const void*)this != (const void*)&other) {
+            clear();
+            reserve(other.size());
+            BOOST_FOREACH (const T2 &item, other.values())
+                pushBack(item);
+        }
+        return *this;
+    }
+
+    /** Clear the list.
+     *
+     *  Erase all items from the list making the list empty. The table's capacity is retained. */
+    void clear() {
+        if (size_ > 0) {
+            for (size_t i = head_; i != NIL; i = slots_[i].next)
+                slots_[i] = Slot();
+        }
+        head_ = tail_ = NIL;
+        size_ = 0;
+    }
+
+    /** Reserve space for items.
+     *
+     *  Makes sure that at least @p n items can be stored without reallocating the table. */
+    void reserve(size_t n) {
+        size_t capacity = slots_.empty() ? 16 : slots_.size();
+        while (n > maxLoad(capacity))
+            capacity *= 2;
+        if (capacity != slots_.size())
+            rehash(capacity);
+    }
+
+    /** Determines whether list is empty.
+     *
+     *  Returns true if the list is empty, false if it contains anything.  Time complexity is constant. */
+    bool isEmpty() const {
+        return 0 == size_;
+    }
+
+    /** Number of items in list.
+     *
+     *  Returns the total number of items in the list in constant time. */
+    size_t size() const {
+        return size_;
+    }
+
+    /** Determine if an item exists.
+     *
+     *  Returns true if the specified item exists in the list, false if not. */
+    bool exists(const Item &item) const {
+        return find(item, hashOf(item)) != NIL;
+    }
+
+    /** Determine the position of an item.
+     *
+     *  Returns the position of an item from the beginning of the list, or the size of the list if the item doesn't
+     *  exist. This is an O(n) operation. */
+    size_t position(const Item &item) const {
+        size_t found = find(item, hashOf(item));
+        if (NIL == found)
+            return size_;
+        size_t retval = 0;
+        for (size_t i = head_; i != found; i = slots_[i].next)
+            ++retval;
+        return retval;
+    }
+
+    /** Reference to item at front of list.
+     *
+     *  Returns a const reference to the item at the front of the list, or throws an <code>std::runtime_error</code> if the
+     *  list is empty. */
+    const Item& front() const {
+        if (isEmpty())
+            throw std::runtime_error("front called on empty list");
+        return slots_[head_].item;
+    }
+
+    /** Reference to item at back of list.
+     *
+     *  Returns a const reference to the item at the back of the list, or throws an <code>std::runtime_error</code> if the
+     *  list is empty. */
+    const Item& back() const {
+        if (isEmpty())
+            throw std::runtime_error("back called on empty list");
+        return slots_[tail_].item;
+    }
+
+    /** Insert item at front of list if distinct.
+     *
+     *  If @p item does not exist in the list then insert a copy at the front of the list. If the item exists then do nothing.
+     *  Returns true if the item was inserted. */
+    bool pushFront(const Item &item) {
+        size_t idx = insertSlot(item);
+        if (NIL == idx)
+            return false;
+        slots_[idx].next = head_;
+        if (head_ != NIL) {
+            slots_[head_].prev = idx;
+        } else {
+            tail_ = idx;
+        }
+        head_ = idx;
+        return true;
+    }
+
+    /** Insert item at back of list if distinct.
+     *
+     *  If @p item does not exist in the list then insert a copy at the back of the list. If the item exists then do nothing.
+     *  Returns true if the item was inserted. */
+    bool pushBack(const Item &item) {
+        size_t idx = insertSlot(item);
+        if (NIL == idx)
+            return false;
+        slots_[idx].prev = tail_;
+        if (tail_ != NIL) {
+            slots_[tail_].next = idx;
+        } else {
+            head_ = idx;
+        }
+        tail_ = idx;
+        return true;
+    }
+
+    /** Return and erase item at front of list.
+     *
+     *  Returns a copy of the item at the front of the list and that item is removed from the list.  Throws an
+     *  <code>std::runtime_error</code> if the list is empty. */
+    Item popFront() {
+        if (isEmpty())
+            throw std::runtime_error("popFront called on empty list");
+        Item item = slots_[head_].item;
+        eraseSlot(head_);
+        return item;
+    }
+
+    /** Return and erase item at back of list.
+     *
+     *  Returns a copy of the item at the back of the list and that item is removed from the list.  Throws an
+     *  <code>std::runtime_error</code> if the list is empty. */
+    Item popBack() {
+        if (isEmpty())
+            throw std::runtime_error("popBack called on empty list");
+        Item item = slots_[tail_].item;
+        eraseSlot(tail_);
+        return item;
+    }
+
+    /** Erase an item from the list.
+     *
+     *  Erases the item equal to @p item from the list if it exists, does nothing otherwise. Returns true if an item was
+     *  erased. */
+    bool erase(const Item &item) {
+        size_t found = find(item, hashOf(item));
+        if (NIL == found)
+            return false;
+        eraseSlot(found);
+        return true;
+    }
+
+    /** Iterators for all items in list order. */
+    boost::iterator_range<ConstIterator> values() const {
+        return boost::iterator_range<ConstIterator>(ConstIterator(this, head_), ConstIterator(this, NIL));
+    }
+
+    /** Return all items as a vector in list order. */
+    std::vector<Item> items() const {
+        std::vector<Item> retval;
+        retval.reserve(size_);
+        for (size_t i = head_; i != NIL; i = slots_[i].next)
+            retval.push_back(slots_[i].item);
+        return retval;
+    }
+
+private:
+    // Maximum number of items for a table with the specified number of slots. Linear probing degrades quickly above
+    // three-fourths full.
+    static size_t maxLoad(size_t capacity) {
+        return capacity / 4 * 3;
+    }
+
+    // Hash of an item. The user's hash is mixed so that identity hashes, such as boost::hash for integers, don't form long
+    // probe sequences when keys share their low-order bits.
+    size_t hashOf(const Item &item) const {
+        boost::uint64_t h = hasher_(item);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return (size_t)h;
+    }
+
+    // Slot index of an item, or NIL if not present.
+    size_t find(const Item &item, size_t hash) const {
+        if (slots_.empty())
+            return NIL;
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = hash & mask; slots_[i].occupied; i = (i + 1) & mask) {
+            if (slots_[i].hash == hash && equal_(slots_[i].item, item))
+                return i;
+        }
+        return NIL;
+    }
+
+    // Store an item in an empty slot and return the slot index, or NIL if the item already exists. The new slot is not
+    // linked into the list.
+    size_t insertSlot(const Item &item) {
+        const size_t hash = hashOf(item);
+        if (size_ + 1 > maxLoad(slots_.size())) {
+            if (find(item, hash) != NIL)
+                return NIL;
+            rehash(slots_.empty() ? 16 : 2 * slots_.size());
+        }
+        const size_t mask = slots_.size() - 1;
+        size_t i = hash & mask;
+        for (/*void*/; slots_[i].occupied; i = (i + 1) & mask) {
+            if (slots_[i].hash == hash && equal_(slots_[i].item, item))
+                return NIL;
+        }
+        Slot &slot = slots_[i];
+        slot.item = item;
+        slot.hash = hash;
+        slot.prev = slot.next = NIL;
+        slot.occupied = true;
+        ++size_;
+        return i;
+    }
+
+    // Unlink and free a slot, then shift later members of the probe sequence backward so that no tombstones are needed.
+    void eraseSlot(size_t hole) {
+        Slot &slot = slots_[hole];
+        if (slot.prev != NIL) {
+            slots_[slot.prev].next = slot.next;
+        } else {
+            head_ = slot.next;
+        }
+        if (slot.next != NIL) {
+            slots_[slot.next].prev = slot.prev;
+        } else {
+            tail_ = slot.prev;
+        }
+        --size_;
+
+        const size_t mask = slots_.size() - 1;
+        for (size_t j = (hole + 1) & mask; slots_[j].occupied; j = (j + 1) & mask) {
+            // The item in slot j can fill the hole only if its home slot is not cyclically within (hole, j].
+            size_t home = slots_[j].hash & mask;
+            bool stays = hole <= j ? (hole < home && home <= j) : (hole < home || home <= j);
+            if (!stays) {
+                moveSlot(j, hole);
+                hole = j;
+            }
+        }
+        slots_[hole] = Slot();
+    }
+
+    // Move an occupied slot to an unoccupied slot and update the list links that point to it.
+    void moveSlot(size_t from, size_t to) {
+        Slot &src = slots_[from];
+        Slot &dst = slots_[to];
+        std::swap(dst.item, src.item);
+        dst.hash = src.hash;
+        dst.prev = src.prev;
+        dst.next = src.next;
+        dst.occupied = true;
+        if (dst.prev != NIL) {
+            slots_[dst.prev].next = to;
+        } else {
+            head_ = to;
+        }
+        if (dst.next != NIL) {
+            slots_[dst.next].prev = to;
+        } else {
+            tail_ = to;
+        }
+    }
+
+    // Rebuild the table with the specified number of slots, preserving list order.
+    void rehash(size_t capacity) {
+        std::vector<Slot> old(capacity);
+        old.swap(slots_);
+        size_t oldHead = head_;
+        head_ = tail_ = NIL;
+        size_ = 0;
+        const size_t mask = capacity - 1;
+        for (size_t from = oldHead; from != NIL; from = old[from].next) {
+            size_t i = old[from].hash & mask;
+            while (slots_[i].occupied)
+                i = (i + 1) & mask;
+            Slot &slot = slots_[i];
+            std::swap(slot.item, old[from].item);
+            slot.hash = old[from].hash;
+            slot.prev = tail_;
+            slot.occupied = true;
+            if (tail_ != NIL) {
+                slots_[tail_].next = i;
+            } else {
+                head_ = i;
+            }
+            tail_ = i;
+            ++size_;
+        }
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
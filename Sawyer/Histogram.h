@@ -2,45 +2,144 @@
 #define Sawyer_Histogram_H
 
 #include <Sawyer/Assert.h>
+#include <Sawyer/HashMap.h>
 #include <Sawyer/Map.h>
 #include <Sawyer/Sawyer.h>
 #include <boost/foreach.hpp>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace Sawyer {
 
 /** %Histogram of symbols.
  *
  *  This class is a histogram of symbols of type @p T.  Symbols are inserted with the @ref insert method and erased with the @p
- *  erase method.  At any point, various statistics can be queried. */
+ *  erase method.  At any point, various statistics can be queried.
+ *
+ *  By default, queries about the most frequent symbols scan all the symbols. A program that asks such questions often can call
+ *  @ref maintainIndex to have the histogram also keep its symbols in a list of buckets ordered by count (as in the
+ *  Space-Saving algorithm). Each insertion or erasure then moves the symbol to an adjacent bucket in constant time, and the
+ *  @ref mostFrequentSymbols, @ref highestCount, and @ref topSymbols queries take time proportional to the size of their
+ *  result.
+ *
+ *  When the number of distinct symbols is unbounded, @ref approximate limits the histogram to a fixed number of symbols. When a
+ *  new symbol is inserted into a full histogram, it replaces one of the least frequent symbols and inherits that symbol's count
+ *  plus one. The counts are therefore upper bounds and the @ref countError method says by how much a count might exceed the
+ *  true number of occurrences. Any symbol whose true count exceeds the total number of insertions divided by the capacity is
+ *  guaranteed to be present.
+ *
+ *  Subclasses that modify the @c map_ data member directly must not enable the index. */
 template<typename T, class Cmp = std::less<T> >
 class Histogram {
 public:
     typedef T Value;
     typedef Sawyer::Container::Map<Value, size_t, Cmp> ForwardMap;
     typedef Sawyer::Container::Map<size_t, std::vector<Value> > ReverseMap;
+
+    /** A symbol and its count. */
+    typedef std::pair<Value, size_t> SymbolCount;
+
 protected:
     ForwardMap map_;
+
+private:
+    struct Bucket;
+
+    // Index information for one symbol.
+    struct Entry {
+        typename ForwardMap::NodeIterator node;         // the symbol and its count
+        size_t error;                                   // amount by which the count might exceed the true count
+        Bucket *bucket;                                 // bucket whose count equals this symbol's count
+        Entry *prev, *next;                             // doubly linked list of entries in the same bucket
+
+        Entry(): error(0), bucket(NULL), prev(NULL), next(NULL) {}
+    };
+
+    // All symbols having the same count.
+    struct Bucket {
+        size_t count;
+        Bucket *prev, *next;                            // doubly linked list of buckets in increasing order of count
+        Entry *first;                                   // entries having this count; never empty
+    };
+
+    // The entries are keyed by the address of the count in map_, which is stable since the map is node based. Likewise, the
+    // entries themselves have stable addresses in the node-based hash map.
+    typedef Sawyer::Container::HashMap<const size_t*, Entry> Entries;
+
+    bool indexed_;                                      // whether the following members are maintained
+    size_t capacity_;                                   // maximum number of symbols when approximating, or zero
+    Entries entries_;
+    Bucket *lowest_, *highest_;                         // ends of the bucket list
+    std::vector<Bucket*> spareBuckets_;                 // buckets to reuse rather than allocating
+
 public:
+    /** Construct an empty histogram without an index. */
+    Histogram()
+        : indexed_(false), capacity_(0), lowest_(NULL), highest_(NULL) {}
+
+    Histogram(const Histogram &other)
+        : indexed_(false), capacity_(0), lowest_(NULL), highest_(NULL) {
+        copyFrom(other);
+    }
+
+    Histogram& operator=(const Histogram &other) {
+        if (this != &other) {
+            maintainIndex(false);
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ~Histogram() {
+        maintainIndex(false);
+        BOOST_FOREACH (Bucket *bucket, spareBuckets_)
+            delete bucket;
+    }
 
     /** Insert a symbol.
      *
      *  The symbol is inserted into this histogram and statistics are updated. */
     void insert(T symbol) {
         size_t &count = map_.insertMaybe(symbol, 0);
-        ++count;
+        if (!indexed_) {
+            ++count;
+        } else if (count > 0) {
+            ++count;
+            promote(entries_[&count]);
+        } else if (capacity_ > 0 && map_.size() > capacity_) {
+            // Space-Saving: replace one of the least frequent symbols and inherit its count as the error.
+            const size_t minCount = lowest_->count;
+            removeEntry(*lowest_->first);
+            count = minCount + 1;
+            addEntry(symbol, minCount);
+        } else {
+            count = 1;
+            addEntry(symbol, 0);
+        }
     }
 
     /** Erase a symbol.
      *
-     *  The symbol, which must exist in the histogram, is removed from the histogram and statistics are updated. */
+     *  The symbol, which must exist in the histogram, is removed from the histogram and statistics are updated. When
+     *  approximating, the symbol might have been displaced by other symbols, in which case this method does nothing. */
     void erase(T symbol) {
         typename ForwardMap::NodeIterator found = map_.find(symbol);
+        if (capacity_ > 0 && found == map_.nodes().end())
+            return;
         ASSERT_require(found!=map_.nodes().end());
         ASSERT_require(found->value() > 0);
         if (1==found->value()) {
-            map_.eraseAt(found);
+            if (indexed_) {
+                removeEntry(entry(found));
+            } else {
+                map_.eraseAt(found);
+            }
         } else {
             --found->value();
+            if (indexed_)
+                demote(entry(found));
         }
     }
 
@@ -53,11 +152,23 @@ public:
 
     /** Number of occurrences of a symbol.
      *
-     *  Returns the number of times the symbol appears in this histogram. */
+     *  Returns the number of times the symbol appears in this histogram. When approximating, this is an upper bound; see @ref
+     *  countError. */
     size_t count(T symbol) const {
         return map_.getOptional(symbol).orElse(0);
     }
 
+    /** Maximum overestimate of a count.
+     *
+     *  Returns the amount by which @ref count might exceed the true number of occurrences of the symbol. This is always zero
+     *  unless the histogram is approximating. */
+    size_t countError(T symbol) const {
+        if (!indexed_)
+            return 0;
+        typename ForwardMap::ConstNodeIterator found = map_.find(symbol);
+        return found == map_.nodes().end() ? 0 : entries_[&found->value()].error;
+    }
+
     /** Histogram map.
      *
      *  Returns the histogram map whose keys are the symbols and whose values are the counts. */
@@ -75,10 +186,21 @@ public:
         return cmap;
     }
 
-    /** Returns the symbols with the highest frequency. */
+    /** Returns the symbols with the highest frequency.
+     *
+     *  The symbols are sorted. */
     std::vector<Value> mostFrequentSymbols() const {
         std::vector<Value> bestSymbols;
-        size_t bestFrequency;
+        if (indexed_) {
+            if (highest_) {
+                for (const Entry *e = highest_->first; e; e = e->next)
+                    bestSymbols.push_back(e->node->key());
+                std::sort(bestSymbols.begin(), bestSymbols.end(), Cmp());
+            }
+            return bestSymbols;
+        }
+
+        size_t bestFrequency = 0;
         BOOST_FOREACH (const typename ForwardMap::Node &node, map_.nodes()) {
             if (bestSymbols.empty() || node.value()>bestFrequency) {
                 bestSymbols.clear();
@@ -90,6 +212,224 @@ public:
         }
         return bestSymbols;
     }
+
+    /** Highest count of any symbol.
+     *
+     *  Returns the count of the most frequent symbols, or zero if the histogram is empty. */
+    size_t highestCount() const {
+        if (indexed_)
+            return highest_ ? highest_->count : 0;
+        size_t retval = 0;
+        BOOST_FOREACH (size_t n, map_.values())
+            retval = std::max(retval, n);
+        return retval;
+    }
+
+    /** Returns the most frequent symbols.
+     *
+     *  Returns up to @p k symbols and their counts, in order of decreasing count. Symbols having the same count are in no
+     *  particular order, and if the <em>k</em>th symbol ties with others then which of them are returned is also unspecified.
+     *  With an index this takes time proportional to @p k, otherwise it scans all the symbols. */
+    std::vector<SymbolCount> topSymbols(size_t k) const {
+        std::vector<SymbolCount> retval;
+        if (indexed_) {
+            for (const Bucket *b = highest_; b && retval.size() < k; b = b->prev) {
+                for (const Entry *e = b->first; e && retval.size() < k; e = e->next)
+                    retval.push_back(SymbolCount(e->node->key(), b->count));
+            }
+        } else {
+            retval.reserve(map_.size());
+            BOOST_FOREACH (const typename ForwardMap::Node &node, map_.nodes())
+                retval.push_back(SymbolCount(node.key(), node.value()));
+            k = std::min(k, retval.size());
+            std::partial_sort(retval.begin(), retval.begin() + k, retval.end(), HigherCount());
+            retval.resize(k);
+        }
+        return retval;
+    }
+
+    /** Property: Whether the frequency index is maintained.
+     *
+     *  Enabling the index takes time proportional to the number of symbols times its logarithm. Disabling the index also stops
+     *  approximating.
+     *
+     * @{ */
+    bool isIndexed() const {
+        return indexed_;
+    }
+    Histogram& maintainIndex(bool b = true) {
+        if (b && !indexed_) {
+            buildIndex();
+        } else if (!b && indexed_) {
+            while (lowest_) {
+                Bucket *next = lowest_->next;
+                releaseBucket(lowest_);
+                lowest_ = next;
+            }
+            highest_ = NULL;
+            entries_.clear();
+            indexed_ = false;
+            capacity_ = 0;
+        }
+        return *this;
+    }
+    /** @} */
+
+    /** Limit the number of symbols.
+     *
+     *  Enables the index and limits the histogram to at most @p capacity distinct symbols, discarding the least frequent
+     *  symbols if there are currently too many. A capacity of zero removes the limit, although the counts of a histogram that
+     *  has already approximated remain approximate. */
+    Histogram& approximate(size_t capacity) {
+        maintainIndex(true);
+        capacity_ = capacity;
+        while (capacity_ > 0 && map_.size() > capacity_)
+            removeEntry(*lowest_->first);
+        return *this;
+    }
+
+    /** Maximum number of symbols when approximating.
+     *
+     *  Returns zero if the histogram is not limited. */
+    size_t capacity() const {
+        return capacity_;
+    }
+
+private:
+    struct HigherCount {
+        bool operator()(const SymbolCount &a, const SymbolCount &b) const {
+            return a.second > b.second;
+        }
+    };
+
+    struct LowerCount {
+        bool operator()(typename ForwardMap::NodeIterator a, typename ForwardMap::NodeIterator b) const {
+            return a->value() < b->value();
+        }
+    };
+
+    Entry& entry(typename ForwardMap::NodeIterator node) {
+        return entries_[&node->value()];
+    }
+
+    void copyFrom(const Histogram &other) {
+        map_ = other.map_;
+        if (other.indexed_) {
+            buildIndex();
+            capacity_ = other.capacity_;
+            for (typename ForwardMap::NodeIterator node = map_.nodes().begin(); node != map_.nodes().end(); ++node) {
+                typename ForwardMap::ConstNodeIterator otherNode = other.map_.find(node->key());
+                entry(node).error = other.entries_[&otherNode->value()].error;
+            }
+        }
+    }
+
+    void buildIndex() {
+        ASSERT_forbid(indexed_);
+        std::vector<typename ForwardMap::NodeIterator> nodes;
+        nodes.reserve(map_.size());
+        for (typename ForwardMap::NodeIterator node = map_.nodes().begin(); node != map_.nodes().end(); ++node)
+            nodes.push_back(node);
+        std::sort(nodes.begin(), nodes.end(), LowerCount());
+        indexed_ = true;
+        BOOST_FOREACH (typename ForwardMap::NodeIterator node, nodes) {
+            Entry &e = entries_.insertMaybeDefault(&node->value());
+            e.node = node;
+            if (!highest_ || highest_->count != node->value())
+                newBucket(highest_, NULL, node->value());
+            link(e, highest_);
+        }
+    }
+
+    // Create a new bucket between two adjacent buckets, either of which may be null at the ends of the list.
+    Bucket* newBucket(Bucket *prev, Bucket *next, size_t count) {
+        Bucket *b = NULL;
+        if (spareBuckets_.empty()) {
+            b = new Bucket;
+        } else {
+            b = spareBuckets_.back();
+            spareBuckets_.pop_back();
+        }
+        b->count = count;
+        b->first = NULL;
+        b->prev = prev;
+        b->next = next;
+        (prev ? prev->next : lowest_) = b;
+        (next ? next->prev : highest_) = b;
+        return b;
+    }
+
+    void releaseBucket(Bucket *b) {
+        spareBuckets_.push_back(b);
+    }
+
+    void link(Entry &e, Bucket *b) {
+        e.bucket = b;
+        e.prev = NULL;
+        e.next = b->first;
+        if (b->first)
+            b->first->prev = &e;
+        b->first = &e;
+    }
+
+    // Remove an entry from its bucket, and remove the bucket from the list if it becomes empty.
+    void unlink(Entry &e) {
+        Bucket *b = e.bucket;
+        (e.prev ? e.prev->next : b->first) = e.next;
+        if (e.next)
+            e.next->prev = e.prev;
+        if (!b->first) {
+            (b->prev ? b->prev->next : lowest_) = b->next;
+            (b->next ? b->next->prev : highest_) = b->prev;
+            releaseBucket(b);
+        }
+    }
+
+    // The entry's count was just incremented; move it to the next bucket.
+    void promote(Entry &e) {
+        const size_t count = e.node->value();
+        Bucket *b = e.bucket;
+        Bucket *target = b->next && b->next->count == count ? b->next : newBucket(b, b->next, count);
+        unlink(e);
+        link(e, target);
+    }
+
+    // The entry's count was just decremented; move it to the previous bucket.
+    void demote(Entry &e) {
+        const size_t count = e.node->value();
+        e.error = std::min(e.error, count);
+        Bucket *b = e.bucket;
+        Bucket *target = b->prev && b->prev->count == count ? b->prev : newBucket(b->prev, b, count);
+        unlink(e);
+        link(e, target);
+    }
+
+    // Create the entry for a symbol that was just added to the map with its initial count.
+    void addEntry(const Value &symbol, size_t error) {
+        typename ForwardMap::NodeIterator node = map_.find(symbol);
+        const size_t count = node->value();
+        Entry &e = entries_.insertMaybeDefault(&node->value());
+        e.node = node;
+        e.error = error;
+
+        // The count is at most one more than the lowest count, so the bucket is found within a couple of steps.
+        Bucket *prev = NULL, *b = lowest_;
+        while (b && b->count < count) {
+            prev = b;
+            b = b->next;
+        }
+        if (!b || b->count != count)
+            b = newBucket(prev, b, count);
+        link(e, b);
+    }
+
+    // Remove a symbol and its entry.
+    void removeEntry(Entry &e) {
+        typename ForwardMap::NodeIterator node = e.node;
+        unlink(e);
+        entries_.erase(&node->value());
+        map_.eraseAt(node);
+    }
 };
 
 } // namespace
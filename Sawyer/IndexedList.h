@@ -87,30 +87,30 @@ private:
         explicit ProtoNode(size_t id=NO_ID): id(id), next(this), prev(this) {}
         bool isHead() const { return id==NO_ID; }       // implies no Node memory is attached; don't static_cast to Node!
         void insert(ProtoNode &newNode) {               // insert newNode before this node
-            ASSERT_forbid(newNode.isHead());
-            ASSERT_require(newNode.next==&newNode);
-            ASSERT_require(newNode.prev==&newNode);
+            ASSERT_hot_forbid(INDEXEDLIST, newNode.isHead());
+            ASSERT_hot_require(INDEXEDLIST, newNode.next==&newNode);
+            ASSERT_hot_require(INDEXEDLIST, newNode.prev==&newNode);
             prev->next = &newNode;
             newNode.prev = prev;
             prev = &newNode;
             newNode.next = this;
         }
         void remove() {                                 // remove this node from the list
-            ASSERT_forbid(isHead());
+            ASSERT_hot_forbid(INDEXEDLIST, isHead());
             prev->next = next;
             next->prev = prev;
             next = prev = this;
         }
         Node& dereference() {
-            ASSERT_forbid(isHead());
+            ASSERT_hot_forbid(INDEXEDLIST, isHead());
             Node *node = (Node*)this;                   // ProtoNode must be first data member of Node
-            ASSERT_require(&node->linkage_ == this);    // it wasn't first
+            ASSERT_hot_require(INDEXEDLIST, &node->linkage_ == this); // it wasn't first
             return *node;
         }
         const Node& dereference() const {
-            ASSERT_forbid(isHead());
+            ASSERT_hot_forbid(INDEXEDLIST, isHead());
             const Node *node = (const Node*)this;       // ProtoNode must be first data member of Node
-            ASSERT_require(&node->linkage_ == this);    // it wasn't first
+            ASSERT_hot_require(INDEXEDLIST, &node->linkage_ == this); // it wasn't first
             return *node;
         }
     };
@@ -125,7 +125,7 @@ public:
         Value value_;                                   // User-supplied data for each node
     private:
         friend class IndexedList;
-        Node(size_t id, const Value &value): linkage_(id), value_(value) { ASSERT_forbid(linkage_.isHead()); }
+        Node(size_t id, const Value &value): linkage_(id), value_(value) { ASSERT_hot_forbid(INDEXEDLIST, linkage_.isHead()); }
     public:
         /** Unique identification number.
          *
@@ -501,12 +501,12 @@ public:
      * @{ */
     NodeIterator find(size_t id) {
         ASSERT_require(id < index_.size());
-        ASSERT_not_null(index_[id]);
+        ASSERT_hot_not_null(INDEXEDLIST, index_[id]);
         return NodeIterator(index_[id]);
     }
     ConstNodeIterator find(size_t id) const {
         ASSERT_require(id < index_.size());
-        ASSERT_not_null(index_[id]);
+        ASSERT_hot_not_null(INDEXEDLIST, index_[id]);
         return ConstNodeIterator(index_[id]);
     }
     /** @} */
@@ -567,12 +567,12 @@ public:
      * @{ */
     Node& indexedNode(size_t id) {
         ASSERT_require(id < size());
-        ASSERT_not_null(index_[id]);
+        ASSERT_hot_not_null(INDEXEDLIST, index_[id]);
         return *index_[id];
     }
     const Node& indexedNode(size_t id) const {
         ASSERT_require(id < size());
-        ASSERT_not_null(index_[id]);
+        ASSERT_hot_not_null(INDEXEDLIST, index_[id]);
         return *index_[id];
     }
     Value& indexedValue(size_t id) {
@@ -705,6 +705,41 @@ public:
         return NodeIterator(next);
     }
 
+    /** Erase many elements.
+     *
+     *  Erases every element whose ID is marked in @p marked, which must have one entry per element. As when erasing elements
+     *  one at a time, the gaps left in the ID sequence are filled by renumbering the remaining elements that have the highest
+     *  IDs, but each of those elements is renumbered only once.  Returns a table indexed by old ID that contains each
+     *  element's new ID, or <code>(size_t)(-1)</code> for erased elements.
+     *
+     *  Time complexity is linear in the number of elements erased, plus the time to create the returned table. */
+    std::vector<size_t> eraseMarked(const std::vector<bool> &marked) {
+        ASSERT_require(marked.size() == index_.size());
+        size_t n = index_.size();
+        std::vector<size_t> idMap(n);
+        for (size_t i=0; i<n; ++i)
+            idMap[i] = i;
+        for (size_t i=0; i<n; ++i) {
+            if (!marked[i])
+                continue;
+            destroyIndexed(i);
+            idMap[i] = NO_ID;
+            while (n > i+1 && marked[n-1]) {
+                destroyIndexed(--n);
+                idMap[n] = NO_ID;
+            }
+            if (n > i+1) {
+                index_[i] = index_[--n];
+                index_[i]->linkage_.id = i;
+                idMap[n] = i;
+            } else {
+                n = i;
+            }
+        }
+        index_.resize(n);
+        return idMap;
+    }
+
     // range must be a range within this container
     NodeIterator eraseAtMultiple(const boost::iterator_range<NodeIterator> &range) {
         boost::iterator_range<ValueIterator> valueRange(range.begin(), range.end());
@@ -732,6 +767,15 @@ public:
             ASSERT_require(pn->prev->next == pn);
         }
     }
+
+private:
+    // Unlinks and deletes the node with the specified ID without changing the index.
+    void destroyIndexed(size_t id) {
+        Node *node = index_[id];
+        node->linkage_.remove();
+        node->~Node();
+        allocator_.deallocate((void*)node, sizeof(Node));
+    }
 };
 
 } // namespace
@@ -218,6 +218,7 @@ private:
     Map map_;
     Policy policy_;
     typename Interval::Value size_;                     // number of values (map_.size is number of intervals)
+    size_t generation_;                                 // incremented by each modification
 
 private:
     friend class boost::serialization::access;
@@ -227,6 +228,7 @@ private:
         s & BOOST_SERIALIZATION_NVP(map_);
         s & BOOST_SERIALIZATION_NVP(policy_);
         s & BOOST_SERIALIZATION_NVP(size_);
+        ++generation_;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -236,14 +238,31 @@ public:
     /** Default constructor.
      *
      *  Creates an empty container. */
-    IntervalMap(): size_(0) {}
+    IntervalMap(): size_(0), generation_(0) {}
+
+    /** Copy constructor.
+     *
+     *  Initialize this container by copying all nodes from the @p other container. */
+    IntervalMap(const IntervalMap &other)
+        : map_(other.map_), policy_(other.policy_), size_(other.size_), generation_(0) {}
+
+    /** Move constructor.
+     *
+     *  Takes the nodes from the @p other container, which is left empty. The other container's @ref generation is
+     *  incremented. */
+    IntervalMap(IntervalMap &&other)
+        : map_(std::move(other.map_)), policy_(other.policy_), size_(other.size_), generation_(0) {
+        other.size_ = 0;
+        ++other.generation_;
+    }
 
     /** Copy constructor.
      *
      *  Initialize this container by copying all nodes from the @p other container.  This constructor has <em>O(n)</em>
      *  complexity, where <em>n</em> is the number of nodes in the container. */
     template<class Interval2, class T2, class Policy2>
-    IntervalMap(const IntervalMap<Interval2, T2, Policy2> &other) {
+    IntervalMap(const IntervalMap<Interval2, T2, Policy2> &other)
+        : size_(0), generation_(0) {
         typedef typename IntervalMap<Interval2, T2, Policy2>::ConstNodeIterator OtherIterator;
         for (OtherIterator otherIter=other.nodes().begin(); other!=other.nodes().end(); ++other)
             insert(Interval(otherIter->key()), Value(otherIter->value()));
@@ -252,7 +271,29 @@ public:
     /** Assignment operator.
      *
      *  Makes this container look like the @p other container by clearing this container and then copying all nodes from the
-     *  other container. */
+     *  other container.
+     *
+     * @{ */
+    IntervalMap& operator=(const IntervalMap &other) {
+        map_ = other.map_;
+        policy_ = other.policy_;
+        size_ = other.size_;
+        ++generation_;
+        return *this;
+    }
+
+    IntervalMap& operator=(IntervalMap &&other) {
+        if (this != &other) {
+            map_ = std::move(other.map_);
+            policy_ = other.policy_;
+            size_ = other.size_;
+            other.size_ = 0;
+            ++generation_;
+            ++other.generation_;
+        }
+        return *this;
+    }
+
     template<class Interval2, class T2, class Policy2>
     IntervalMap& operator=(const IntervalMap<Interval2, T2, Policy2> &other) {
         clear();
@@ -261,6 +302,7 @@ public:
             insert(Interval(otherIter->key()), Value(otherIter->value()));
         return *this;
     }
+    /** @} */
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     //                                  Searching
@@ -753,16 +795,37 @@ public:
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
+    /** Modification counter.
+     *
+     *  Returns a number that's incremented whenever intervals are inserted or erased, or the container is assigned a new value.
+     *  Objects that cache information about this container, such as translations from scalars to values, can compare this
+     *  number with the value it had when the information was cached in order to discover that the information is stale.
+     *  Values that are modified in place through mutable iterators are not detected; the code modifying them should call @ref
+     *  markModified. */
+    size_t generation() const {
+        return generation_;
+    }
+
+    /** Record an in-place modification.
+     *
+     *  Increments the @ref generation number, which should be done after modifying values in place through mutable
+     *  iterators. */
+    void markModified() {
+        ++generation_;
+    }
+
     /** Empties the container. */
     void clear() {
         map_.clear();
         size_ = 0;
+        ++generation_;
     }
 
     /** Erase the specified interval. */
     void erase(const Interval &erasure) {
         if (erasure.isEmpty())
             return;
+        ++generation_;
 
         // Find what needs to be removed, and create a list of things to insert, but delay actual removing until after
         // the loop since Map::erase doesn't return a next iterator.
@@ -831,6 +894,7 @@ public:
     void insert(Interval key, Value value, bool makeHole=true) {
         if (key.isEmpty())
             return;
+        ++generation_;
         if (makeHole) {
             erase(key);
         } else {
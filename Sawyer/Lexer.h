@@ -2,16 +2,93 @@
 #define Sawyer_Lexer_H
 
 #include <Sawyer/AllocatingBuffer.h>
+#include <Sawyer/Assert.h>
 #include <Sawyer/LineVector.h>
 #include <Sawyer/Optional.h>
 #include <Sawyer/Sawyer.h>
 
 #include <boost/filesystem.hpp>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
 
 namespace Sawyer {
 
 namespace Lexer {
 
+/** Non-owning view of a sequence of characters.
+ *
+ *  A view points to characters that are owned by something else, such as the content of a @ref TokenStream, and is valid only
+ *  as long as those characters are. It's used to inspect lexemes without copying them into a new string. */
+class StringView {
+    const char *data_;
+    size_t size_;
+
+public:
+    /** Construct an empty view. */
+    StringView(): data_(NULL), size_(0) {}
+
+    /** Construct a view of @p size characters starting at @p data. */
+    StringView(const char *data, size_t size)
+        : data_(data), size_(size) {
+        ASSERT_require(data != NULL || 0 == size);
+    }
+
+    /** Construct a view of a string's characters. */
+    StringView(const std::string &s) /*implicit*/
+        : data_(s.data()), size_(s.size()) {}
+
+    /** Pointer to the first character.
+     *
+     *  The characters are not necessarily NUL-terminated. */
+    const char* data() const { return data_; }
+
+    /** Number of characters. */
+    size_t size() const { return size_; }
+
+    /** Whether the view is empty. */
+    bool isEmpty() const { return 0 == size_; }
+
+    /** Iterators for the characters.
+     *
+     * @{ */
+    const char* begin() const { return data_; }
+    const char* end() const { return data_ + size_; }
+    /** @} */
+
+    /** Character at the specified index. */
+    char operator[](size_t i) const {
+        ASSERT_require(i < size_);
+        return data_[i];
+    }
+
+    /** Copy the characters to a new string. */
+    std::string toString() const {
+        return size_ > 0 ? std::string(data_, size_) : std::string();
+    }
+
+    /** Compare characters for equality.
+     *
+     * @{ */
+    bool operator==(const StringView &other) const {
+        return size_ == other.size_ && (0 == size_ || 0 == memcmp(data_, other.data_, size_));
+    }
+    bool operator==(const char *s) const {
+        ASSERT_not_null(s);
+        return strlen(s) == size_ && (0 == size_ || 0 == memcmp(data_, s, size_));
+    }
+    bool operator!=(const StringView &other) const { return !(*this == other); }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    /** @} */
+};
+
+/** Print the characters of a view. */
+inline std::ostream& operator<<(std::ostream &out, const StringView &s) {
+    out.write(s.data(), s.size());
+    return out;
+}
+
 /** Represents one token of input.
  *
  *  Each token has a user-defined type which is some enumerated constant, or no type at all which means the token represents
@@ -89,27 +166,31 @@ private:
     std::string name_;                                  // name of stream (e.g., a file name)
     Container::LineVector content_;                     // line-oriented character contents of the stream
     size_t at_;                                         // cursor position in stream
-    std::vector<Token> tokens_;                         // current token at [0] plus lookahead
+    std::vector<Token> ring_;                           // circular lookahead buffer; size is zero or a power of two
+    size_t mask_;                                       // ring_.size() - 1, or zero if the ring is empty
+    size_t head_;                                       // index in ring_ of the current token
+    size_t nTokens_;                                    // number of tokens in ring_ starting at head_
 
 public:
     virtual ~TokenStream() {}
 
     /** Create a token stream from the contents of a file. */
     explicit TokenStream(const boost::filesystem::path &fileName)
-        : name_(fileName.string()), content_(fileName.string()), at_(0) {}
+        : name_(fileName.string()), content_(fileName.string()), at_(0), mask_(0), head_(0), nTokens_(0) {}
 
     /** Create a token stream from a string.
      *
      *  The string content is copied into the lexer and thus can be modified after the lexer returns without affecting the
      *  token stream. */
     explicit TokenStream(const std::string &inputString)
-        : name_("string"), content_(Container::AllocatingBuffer<size_t, char>::instance(inputString)), at_(0) {}
+        : name_("string"), content_(Container::AllocatingBuffer<size_t, char>::instance(inputString)), at_(0), mask_(0),
+          head_(0), nTokens_(0) {}
 
     /** Create a token stream from a buffer.
      *
      *  The token stream uses the specified buffer, which should not be modified while the token stream is alive. */
     explicit TokenStream(const Container::Buffer<size_t, char>::Ptr &buffer)
-        : name_("string"), content_(buffer), at_(0) {}
+        : name_("string"), content_(buffer), at_(0), mask_(0), head_(0), nTokens_(0) {}
 
     /** Property: Name of stream. */
     const std::string& name() const {
@@ -135,27 +216,33 @@ public:
      *  The array operator obtains a token from a virtual array whose first element is the current token, second element is one
      *  past the current token, etc.  The array is infinite in length, padded with EOF tokens. */
     const Token& operator[](size_t lookahead) {
+        if (lookahead < nTokens_)
+            return tokenAt(lookahead);
         static const Token eof_;
-        while (lookahead >= tokens_.size()) {
-            if (!tokens_.empty() && tokens_.back().isEof())
+        while (lookahead >= nTokens_) {
+            if (nTokens_ > 0 && tokenAt(nTokens_ - 1).isEof())
                 return eof_;
-            tokens_.push_back(scanNextToken(content_, at_/*in,out*/));
+            if (nTokens_ == ring_.size())
+                grow();
+            ring_[(head_ + nTokens_) & mask_] = scanNextToken(content_, at_/*in,out*/);
+            ++nTokens_;
         }
-        return tokens_[lookahead];
+        return tokenAt(lookahead);
     }
 
     /** Consume some tokens.
      *
      *  Consumes tokens by shifting @p n tokens off the low-end of the virtual array of tokens. It is permissible to consume
-     *  EOF tokens since more will be generated once the end-of-input is reached. */
+     *  EOF tokens since more will be generated once the end-of-input is reached. Time complexity is constant. */
     void consume(size_t n = 1) {
         const Token &t = current();
         if (t.isEof()) {
             // void
-        } else if (n >= tokens_.size()) {
-            tokens_.clear();
+        } else if (n >= nTokens_) {
+            head_ = nTokens_ = 0;
         } else {
-            tokens_.erase(tokens_.begin(), tokens_.begin() + n);
+            head_ = (head_ + n) & mask_;
+            nTokens_ -= n;
         }
     }
 
@@ -169,18 +256,32 @@ public:
      *  The no-argument version returns the lexeme of the current token.
      *
      *  If you're trying to build a fast lexical analyzer, don't call this function to compare a lexeme against some known
-     *  string. Instead, use @ref match, which doesn't require copying.
+     *  string. Instead, use @ref match or @ref lexemeView, which don't require copying.
      *
      *  @{ */
     std::string lexeme(const Token &t) {
+        return lexemeView(t).toString();
+    }
+    std::string lexeme() {
+        return lexeme(current());
+    }
+    /** @} */
+
+    /** Return a view of the lexeme for a token.
+     *
+     *  This is like @ref lexeme except the returned value points into the stream's content instead of copying it. The view is
+     *  valid as long as this token stream exists.
+     *
+     *  @{ */
+    StringView lexemeView(const Token &t) {
         if (const char *s = content_.characters(t.begin())) {
-            return std::string(s, t.end() - t.begin());
+            return StringView(s, t.end() - t.begin());
         } else {
-            return "";
+            return StringView();
         }
     }
-    std::string lexeme() {
-        return lexeme(current());
+    StringView lexemeView() {
+        return lexemeView(current());
     }
     /** @} */
 
@@ -209,12 +310,7 @@ public:
      * @{ */
     bool match(const Token &t, const char *s) {
         ASSERT_not_null(s);
-        size_t n1 = t.end() - t.begin();
-        size_t n2 = strlen(s);
-        if (n1 != n2)
-            return false;
-        const char *lexeme = content_.characters(t.begin());
-        return 0 == strncmp(lexeme, s, n1);
+        return lexemeView(t) == s;
     }
     bool match(const char *s) {
         return match(current(), s);
@@ -248,6 +344,23 @@ public:
      *  be the end then it should return the EOF token (a default-constructed token), after which this function will not be
      *  called again. */
     virtual Token scanNextToken(const Container::LineVector &content, size_t &at /*in,out*/) = 0;
+
+private:
+    // Token at the specified lookahead position, which must already be scanned.
+    const Token& tokenAt(size_t lookahead) const {
+        ASSERT_require(lookahead < nTokens_);
+        return ring_[(head_ + lookahead) & mask_];
+    }
+
+    // Double the capacity of the lookahead buffer, moving the tokens to its beginning.
+    void grow() {
+        std::vector<Token> ring(ring_.empty() ? 16 : 2 * ring_.size());
+        for (size_t i = 0; i < nTokens_; ++i)
+            ring[i] = tokenAt(i);
+        ring_.swap(ring);
+        mask_ = ring_.size() - 1;
+        head_ = 0;
+    }
 };
 
 } // namespace
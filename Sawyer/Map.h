@@ -1,6 +1,7 @@
 #ifndef Sawyer_Map_H
 #define Sawyer_Map_H
 
+#include <Sawyer/Assert.h>
 #include <Sawyer/Interval.h>
 #include <Sawyer/Optional.h>
 #include <Sawyer/Sawyer.h>
@@ -9,6 +10,7 @@
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/map.hpp>
 #include <stdexcept>
+#include <utility>
 
 namespace Sawyer {
 
@@ -317,6 +319,14 @@ public:
         map_ = other.map_;
     }
 
+    /** Move constructor.
+     *
+     *  The @p other map is left empty. */
+    Map(Map &&other)
+        : map_(std::move(other.map_)) {
+        other.map_.clear();
+    }
+
     /** Copy constructor.
      *
      *  Initializes the new map with copies of the nodes of the @p other map.  The keys and values must be convertible from the
@@ -336,6 +346,17 @@ public:
         return *this;
     }
 
+    /** Move another map into this one.
+     *
+     *  The @p other map is left empty. */
+    Map& operator=(Map &&other) {
+        if (this != &other) {
+            map_ = std::move(other.map_);
+            other.map_.clear();
+        }
+        return *this;
+    }
+
     /** Make this map be a copy of another map.
      *
      *  The keys and values of the @p other map must be convertible to the types used for this map. */
@@ -751,7 +772,7 @@ public:
         // std::map can't erase using a const_iterator
         ASSERT_require(iter != keys().end());
         typename StlMap::iterator stdIter = map_.find(*iter);
-        ASSERT_require(stdIter != map_.end());
+        ASSERT_hot_require(MAP, stdIter != map_.end());
         map_.erase(stdIter);
         return *this;
     }
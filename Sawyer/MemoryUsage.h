@@ -0,0 +1,370 @@
+#ifndef Sawyer_MemoryUsage_H
+#define Sawyer_MemoryUsage_H
+
+#include <Sawyer/AddressMap.h>
+#include <Sawyer/AddressSegment.h>
+#include <Sawyer/Attribute.h>
+#include <Sawyer/BitVector.h>
+#include <Sawyer/Graph.h>
+#include <Sawyer/HashMap.h>
+#include <Sawyer/IntervalMap.h>
+#include <Sawyer/IntervalSet.h>
+#include <Sawyer/Map.h>
+#include <Sawyer/Optional.h>
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/Set.h>
+
+#include <boost/any.hpp>
+#include <boost/foreach.hpp>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Sawyer {
+
+/** Estimated memory footprint of an object.
+ *
+ *  An object of this type accumulates the estimated number of bytes used by one or more objects. The bytes are split into two
+ *  categories: @em structure is the overhead of the container itself, such as tree nodes, linked list pointers, hash buckets,
+ *  indexes, and unused capacity; @em payload is the memory occupied by the keys and values that were stored by the user.
+ *
+ *  Accounting is normally shallow: a container counts its own allocations and the in-place size of each of its keys and
+ *  values, but not memory that's owned by those keys and values.  If accounting is recursive, then the memory owned by keys
+ *  and values is also counted, such as the characters of a string, the nodes of a nested container, or the data of an @ref
+ *  Container::AddressMap "AddressMap" segment buffer. Objects that are reachable more than once, such as a buffer shared by
+ *  several address map segments, are counted only the first time they're encountered.
+ *
+ *  The accounting is performed by overloads of the @ref memoryUsage(MemoryUsage&,const T&) "memoryUsage" function, and
+ *  users can provide overloads for their own types, in either the @ref Sawyer name space or in the name space of their type.
+ *  The numbers are estimates since they depend on the internals of the C++ library and do not include overhead imposed by the
+ *  memory allocator.
+ *
+ *  Example:
+ *
+ * @code
+ *  Sawyer::Container::Graph<std::string, int> graph = ...;
+ *  Sawyer::MemoryUsage usage = Sawyer::memoryUsage(graph, true);
+ *  std::cout <<usage.structure() <<" bytes of overhead for " <<usage.payload() <<" bytes of data\n";
+ * @endcode */
+class MemoryUsage {
+    size_t structure_;                                  // bytes used by containers themselves
+    size_t payload_;                                    // bytes used by user data stored in containers
+    bool recursive_;                                    // whether to count memory owned by keys and values
+    std::set<const void*> visited_;                     // shared objects that have already been counted
+
+public:
+    /** Construct an empty accumulator. */
+    explicit MemoryUsage(bool recursive = false)
+        : structure_(0), payload_(0), recursive_(recursive) {}
+
+    /** Whether accounting recurses into keys and values. */
+    bool isRecursive() const {
+        return recursive_;
+    }
+
+    /** Number of bytes of container overhead. */
+    size_t structure() const {
+        return structure_;
+    }
+
+    /** Number of bytes of user data. */
+    size_t payload() const {
+        return payload_;
+    }
+
+    /** Total number of bytes. */
+    size_t total() const {
+        return structure_ + payload_;
+    }
+
+    /** Count some bytes of container overhead. */
+    MemoryUsage& addStructure(size_t nBytes) {
+        structure_ += nBytes;
+        return *this;
+    }
+
+    /** Count some bytes of user data. */
+    MemoryUsage& addPayload(size_t nBytes) {
+        payload_ += nBytes;
+        return *this;
+    }
+
+    /** Test whether a shared object needs to be counted.
+     *
+     *  Returns true the first time it's called for a particular object address, and false thereafter. */
+    bool isFirstVisit(const void *object) {
+        return object != NULL && visited_.insert(object).second;
+    }
+
+    /** Add the counts from another accumulator.
+     *
+     *  The set of visited shared objects is also merged, although objects counted by both accumulators are not subtracted. */
+    MemoryUsage& operator+=(const MemoryUsage &other) {
+        structure_ += other.structure_;
+        payload_ += other.payload_;
+        visited_.insert(other.visited_.begin(), other.visited_.end());
+        return *this;
+    }
+
+    /** Print the counts on one line. */
+    void print(std::ostream &out) const {
+        out <<"structure " <<structure_ <<" bytes, payload " <<payload_ <<" bytes, total " <<total() <<" bytes";
+    }
+};
+
+inline std::ostream&
+operator<<(std::ostream &out, const MemoryUsage &usage) {
+    usage.print(out);
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//                                      Accounting functions
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Estimated per-node sizes of standard library containers, excluding the node's key and value.
+namespace MemoryUsageDetail {
+struct TreeNode {                                       // red-black tree node used by std::map and std::set
+    int color;
+    void *parent, *left, *right;
+};
+
+struct HashNode {                                       // boost::unordered_map node
+    void *next;
+    size_t hash;
+};
+
+struct ListNode {                                       // IndexedList node linkage
+    size_t id;
+    void *next, *prev;
+};
+
+static const size_t TREE_NODE_SIZE = sizeof(TreeNode);
+static const size_t HASH_NODE_SIZE = sizeof(HashNode);
+static const size_t LIST_NODE_SIZE = sizeof(ListNode);
+
+// Bytes allocated for a string's characters, or zero if the small string optimization stores them in place.
+inline size_t
+stringHeapSize(const std::string &s) {
+    const char *data = s.data();
+    const char *self = reinterpret_cast<const char*>(&s);
+    return data < self || data >= self + sizeof s ? s.capacity() + 1 : 0;
+}
+
+// Size of a graph index entry. GraphVoidIndex (the default) stores nothing, and user-defined indexes are assumed to be trees.
+template<class Index>
+size_t
+graphIndexNodeSize(const Index*) {
+    return TREE_NODE_SIZE + 2 * sizeof(void*);
+}
+
+template<class Key, class Iterator>
+size_t
+graphIndexNodeSize(const Container::GraphVoidIndex<Key, Iterator>*) {
+    return 0;
+}
+
+template<class Key, class Iterator>
+size_t
+graphIndexNodeSize(const Container::GraphBimapIndex<Key, Iterator>*) {
+    return TREE_NODE_SIZE + sizeof(Key) + sizeof(Iterator);
+}
+
+template<class Key, class Iterator>
+size_t
+graphIndexNodeSize(const Container::GraphHashIndex<Key, Iterator>*) {
+    return HASH_NODE_SIZE + sizeof(void*) + sizeof(Key) + sizeof(Iterator);
+}
+} // namespace
+
+/** Count memory owned by an object.
+ *
+ *  Adds to @p usage the estimated memory that's owned by @p object, not counting <code>sizeof object</code> itself. The
+ *  in-place size is already accounted for by whatever contains the object. The default implementation is for types that
+ *  don't own any memory.
+ *
+ * @{ */
+template<class T>
+void
+memoryUsage(MemoryUsage&, const T&) {}
+
+inline void
+memoryUsage(MemoryUsage &usage, const std::string &s) {
+    if (size_t nBytes = MemoryUsageDetail::stringHeapSize(s)) {
+        usage.addPayload(s.size());
+        usage.addStructure(nBytes - s.size());
+    }
+}
+
+template<class T, class A>
+void
+memoryUsage(MemoryUsage &usage, const std::vector<T, A> &values) {
+    usage.addPayload(values.size() * sizeof(T));
+    usage.addStructure((values.capacity() - values.size()) * sizeof(T));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const T &value, values)
+            memoryUsage(usage, value);
+    }
+}
+
+template<class T, class U>
+void
+memoryUsage(MemoryUsage &usage, const std::pair<T, U> &pair) {
+    memoryUsage(usage, pair.first);
+    memoryUsage(usage, pair.second);
+}
+
+template<class T>
+void
+memoryUsage(MemoryUsage &usage, const Optional<T> &opt) {
+    if (opt)
+        memoryUsage(usage, *opt);
+}
+
+inline void
+memoryUsage(MemoryUsage &usage, const Container::BitVector &bits) {
+    usage.addPayload(bits.dataSize() * sizeof(Container::BitVector::Word));
+    usage.addStructure((bits.capacity() - bits.size()) / 8);
+}
+
+template<class K, class T, class Cmp, class Alloc>
+void
+memoryUsage(MemoryUsage &usage, const Container::Map<K, T, Cmp, Alloc> &map) {
+    typedef typename Container::Map<K, T, Cmp, Alloc>::Node Node;
+    usage.addStructure(map.size() * MemoryUsageDetail::TREE_NODE_SIZE);
+    usage.addPayload(map.size() * sizeof(Node));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const Node &node, map.nodes()) {
+            memoryUsage(usage, node.key());
+            memoryUsage(usage, node.value());
+        }
+    }
+}
+
+template<class T, class C, class A>
+void
+memoryUsage(MemoryUsage &usage, const Container::Set<T, C, A> &set) {
+    usage.addStructure(set.size() * MemoryUsageDetail::TREE_NODE_SIZE);
+    usage.addPayload(set.size() * sizeof(T));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const T &value, set.values())
+            memoryUsage(usage, value);
+    }
+}
+
+template<class K, class T, class H, class C, class A>
+void
+memoryUsage(MemoryUsage &usage, const Container::HashMap<K, T, H, C, A> &map) {
+    typedef typename Container::HashMap<K, T, H, C, A>::Node Node;
+    usage.addStructure(map.nBuckets() * sizeof(void*) + map.size() * MemoryUsageDetail::HASH_NODE_SIZE);
+    usage.addPayload(map.size() * (sizeof(K) + sizeof(T)));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const Node &node, map.nodes()) {
+            memoryUsage(usage, node.key());
+            memoryUsage(usage, node.value());
+        }
+    }
+}
+
+// An interval set is a map from each interval's greatest value to the interval, so the key is overhead.
+template<class I>
+void
+memoryUsage(MemoryUsage &usage, const Container::IntervalSet<I> &set) {
+    usage.addStructure(set.nIntervals() * (MemoryUsageDetail::TREE_NODE_SIZE + sizeof(typename I::Value)));
+    usage.addPayload(set.nIntervals() * sizeof(I));
+}
+
+template<class I, class T, class Policy>
+void
+memoryUsage(MemoryUsage &usage, const Container::IntervalMap<I, T, Policy> &map) {
+    typedef typename Container::IntervalMap<I, T, Policy>::Node Node;
+    usage.addStructure(map.nIntervals() * MemoryUsageDetail::TREE_NODE_SIZE);
+    usage.addPayload(map.nIntervals() * sizeof(Node));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const Node &node, map.nodes())
+            memoryUsage(usage, node.value());
+    }
+}
+
+// Buffers are reference counted and may be shared by more than one segment, so each is counted once. A NullBuffer has a
+// size but no storage. Segment and buffer names are only for debugging and are counted as structure.
+template<class A, class T>
+void
+memoryUsage(MemoryUsage &usage, const Container::AddressSegment<A, T> &segment) {
+    usage.addStructure(MemoryUsageDetail::stringHeapSize(segment.name()));
+    typename Container::Buffer<A, T>::Ptr buffer = segment.buffer();
+    if (buffer && usage.isFirstVisit(buffer.getRawPointer())) {
+        if (dynamic_cast<const Container::AllocatingBuffer<A, T>*>(buffer.getRawPointer())) {
+            usage.addStructure(sizeof(Container::AllocatingBuffer<A, T>));
+        } else if (dynamic_cast<const Container::StaticBuffer<A, T>*>(buffer.getRawPointer())) {
+            usage.addStructure(sizeof(Container::StaticBuffer<A, T>));
+        } else if (dynamic_cast<const Container::MappedBuffer<A, T>*>(buffer.getRawPointer())) {
+            usage.addStructure(sizeof(Container::MappedBuffer<A, T>));
+        } else {
+            usage.addStructure(sizeof(Container::Buffer<A, T>));
+        }
+        usage.addStructure(MemoryUsageDetail::stringHeapSize(buffer->name()));
+        if (!dynamic_cast<const Container::NullBuffer<A, T>*>(buffer.getRawPointer()))
+            usage.addPayload(buffer->size() * sizeof(T));
+    }
+}
+
+template<class A, class T>
+void
+memoryUsage(MemoryUsage &usage, const Container::AddressMap<A, T> &map) {
+    typedef Container::IntervalMap<Container::Interval<A>, Container::AddressSegment<A, T>,
+                                   Container::AddressMapImpl::SegmentMergePolicy<A, T> > Super;
+    memoryUsage(usage, static_cast<const Super&>(map));
+}
+
+// Each vertex and edge is a list node holding the user's value plus the graph's linkage; the list also has a vector of node
+// pointers indexed by ID.
+template<class V, class E, class VKey, class EKey, class Alloc>
+void
+memoryUsage(MemoryUsage &usage, const Container::Graph<V, E, VKey, EKey, Alloc> &graph) {
+    typedef Container::Graph<V, E, VKey, EKey, Alloc> G;
+    typedef typename Container::GraphIndexTraits<VKey, typename G::ConstVertexIterator>::Index VertexIndex;
+    typedef typename Container::GraphIndexTraits<EKey, typename G::ConstEdgeIterator>::Index EdgeIndex;
+    const size_t vertexNode = MemoryUsageDetail::LIST_NODE_SIZE + sizeof(void*) + sizeof(typename G::Vertex) - sizeof(V);
+    const size_t edgeNode = MemoryUsageDetail::LIST_NODE_SIZE + sizeof(void*) + sizeof(typename G::Edge) - sizeof(E);
+    const size_t vertexIndexNode = MemoryUsageDetail::graphIndexNodeSize(static_cast<const VertexIndex*>(NULL));
+    const size_t edgeIndexNode = MemoryUsageDetail::graphIndexNodeSize(static_cast<const EdgeIndex*>(NULL));
+
+    usage.addStructure(graph.nVertices() * (vertexNode + vertexIndexNode) + graph.nEdges() * (edgeNode + edgeIndexNode));
+    usage.addPayload(graph.nVertices() * sizeof(V) + graph.nEdges() * sizeof(E));
+    if (usage.isRecursive()) {
+        BOOST_FOREACH (const V &value, graph.vertexValues())
+            memoryUsage(usage, value);
+        BOOST_FOREACH (const E &value, graph.edgeValues())
+            memoryUsage(usage, value);
+    }
+}
+
+// Attribute values are type erased, so only the holder's virtual table pointer and the storage node are known.
+template<class SyncTag>
+void
+memoryUsage(MemoryUsage &usage, const Attribute::Storage<SyncTag> &storage) {
+    usage.addStructure(storage.nAttributes() *
+                       (MemoryUsageDetail::TREE_NODE_SIZE + sizeof(Attribute::Id) + sizeof(boost::any) + sizeof(void*)));
+}
+/** @} */
+
+/** Estimated memory footprint of an object.
+ *
+ *  Returns the estimated memory used by @p object, including <code>sizeof object</code>, which is counted as structure. If
+ *  @p recursive is set then memory owned by the object's keys and values is also counted. See @ref MemoryUsage for
+ *  details. */
+template<class T>
+MemoryUsage
+memoryUsage(const T &object, bool recursive = false) {
+    MemoryUsage usage(recursive);
+    usage.addStructure(sizeof object);
+    memoryUsage(usage, object);
+    return usage;
+}
+
+} // namespace
+
+#endif
@@ -2,13 +2,16 @@
 #define Sawyer_Optional_H
 
 #include <Sawyer/Sawyer.h>
+#include <boost/cstdint.hpp>
 #include <boost/serialization/access.hpp>
 #include <boost/serialization/nvp.hpp>
 #include <boost/serialization/split_member.hpp>
 #include <boost/type_traits/aligned_storage.hpp>
 #include <boost/type_traits/type_with_alignment.hpp>
 
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 
 namespace Sawyer {
 
@@ -32,32 +35,146 @@ public:
     bool operator<=(const Nothing&) const { return true; }
 };
 
-/** Holds a value or nothing.
- *
- *  This class is similar to boost::optional except simpler in order to avoid problems we were seeing with Microsoft
- *  compilers.
- *
- *  The stored value type (@ref Value) cannot be a reference type. */
-template<typename T>
-class Optional {
+namespace Detail {
+
+// True if values of type T can be copied and destroyed trivially, in which case Optional and Result can store them in a way
+// that's also trivially copyable and can be passed and returned in registers.
+template<class T>
+struct IsTrivialPayload {
+    static const bool value = std::is_trivially_copy_constructible<T>::value &&
+                              std::is_trivially_copy_assignable<T>::value &&
+                              std::is_trivially_destructible<T>::value;
+};
 
+// Storage for an Optional value whose type is not trivial. The value is constructed in place in suitably aligned memory and
+// explicitly destroyed.
+template<class T, bool = IsTrivialPayload<T>::value>
+class OptionalStorage {
     // Done as a union to avoid aliasing warnings from GCC
     union SAWYER_MAY_ALIAS MayAlias {
         unsigned char data_[sizeof(T)];
         BOOST_DEDUCED_TYPENAME boost::type_with_alignment<boost::alignment_of<T>::value >::type aligner_;
     } mayAlias_;
 
+protected:
     bool isEmpty_;
 
     void *address() { return &mayAlias_; }
     const void*address() const { return &mayAlias_; }
 
+    OptionalStorage(): isEmpty_(true) {}
+
+    explicit OptionalStorage(const T &v): isEmpty_(false) {
+        new (address()) T(v);                           // copy constructed in place
+    }
+
+    OptionalStorage(const OptionalStorage &other) {
+        isEmpty_ = other.isEmpty_;
+        if (!isEmpty_)
+            new (address()) T(other.value());
+    }
+
+    ~OptionalStorage() {
+        if (!isEmpty_)
+            value().~T();
+    }
+
+    OptionalStorage& operator=(const OptionalStorage &other) {
+        if (isEmpty_ && !other.isEmpty_) {
+            new (address()) T(other.value());
+        } else if (!isEmpty_) {
+            if (other.isEmpty_) {
+                value().~T();
+            } else {
+                value() = other.value();
+            }
+        }
+        isEmpty_ = other.isEmpty_;
+        return *this;
+    }
+
+    const T& value() const { return *reinterpret_cast<const T*>(address()); }
+    T& value() { return *reinterpret_cast<T*>(address()); }
+
+    // Store a value using the copy constructor if empty, otherwise the assignment operator.
+    void assign(const T &v) {
+        if (isEmpty_) {
+            new (address()) T(v);
+        } else {
+            value() = v;
+        }
+        isEmpty_ = false;
+    }
+
+    // Destroy the value, if any.
+    void clear() {
+        if (!isEmpty_)
+            value().~T();
+        isEmpty_ = true;
+    }
+};
+
+// Unsigned integer type whose size is the alignment of T, up to a word. A trivially copyable Optional stores its flag in one of
+// these so that the flag fills what would otherwise be padding. When an Optional is returned in registers, GCC assembles it in
+// memory; if the flag is narrower than the register then the register is loaded from a partially written word, which stalls the
+// store-to-load forwarding.
+template<class T, size_t Align = boost::alignment_of<T>::value>
+struct OptionalFlag { typedef uint64_t type; };
+template<class T> struct OptionalFlag<T, 1> { typedef uint8_t type; };
+template<class T> struct OptionalFlag<T, 2> { typedef uint16_t type; };
+template<class T> struct OptionalFlag<T, 4> { typedef uint32_t type; };
+
+// Storage for an Optional value whose type is trivial. The implicit copy constructor, assignment operator, and destructor are
+// all trivial, so the Optional is trivially copyable and its constructors are constexpr.
+template<class T>
+class OptionalStorage<T, true> {
+    union {
+        unsigned char none_[sizeof(T)];                 // zeroed when empty, so the whole object is always initialized
+        T value_;
+    };
+
+protected:
+    typename OptionalFlag<T>::type isEmpty_;
+
+    constexpr OptionalStorage(): none_(), isEmpty_(1) {}
+    constexpr explicit OptionalStorage(const T &v): value_(v), isEmpty_(0) {}
+
+    constexpr const T& value() const { return value_; }
+    T& value() { return value_; }
+
+    void assign(const T &v) {
+        value_ = v;
+        isEmpty_ = 0;
+    }
+
+    void clear() {
+        isEmpty_ = 1;
+    }
+};
+
+} // namespace
+
+/** Holds a value or nothing.
+ *
+ *  This class is similar to boost::optional except simpler in order to avoid problems we were seeing with Microsoft
+ *  compilers.
+ *
+ *  If @ref Value is trivially copyable, then so is the optional, its constructors are @c constexpr, and it can be passed and
+ *  returned in registers.
+ *
+ *  The stored value type (@ref Value) cannot be a reference type. */
+template<typename T>
+class Optional: private Detail::OptionalStorage<T> {
+    typedef Detail::OptionalStorage<T> Super;
+    using Super::isEmpty_;
+
 private:
     friend class boost::serialization::access;
 
     template<class S>
     void save(S &s, const unsigned /*version*/) const {
-        s <<BOOST_SERIALIZATION_NVP(isEmpty_);
+        bool isEmpty = isEmpty_ != 0;
+        s <<boost::serialization::make_nvp("isEmpty_", isEmpty);
         if (!isEmpty_)
             s <<boost::serialization::make_nvp("value", get());
     }
@@ -82,54 +199,28 @@ public:
     /** Default constructs nothing.
      *
      *  Constructs an optional value that points to nothing. The default constructor for @ref Value is not called. */
-    Optional(): isEmpty_(true) {}
+    constexpr Optional() {}
 
     /** Construct from value.
      *
      *  Constructs an optional object that holds a copy of @p v. */
-    Optional(const Value &v): isEmpty_(false) {         // implicit
-        new (address()) Value(v);                    // copy constructed in place
-    }
+    constexpr Optional(const Value &v)                  // implicit
+        : Super(v) {}
 
     /** Construct from nothing.
      *
      *  Constructs an optional object that holds nothing.  The default constructor for @ref Value is not called. */
-    Optional(const Nothing&): isEmpty_(true) {}
+    constexpr Optional(const Nothing&) {}
 
-    /** Copy constructor.
-     *
-     *  Copy constructs an optional so that the new object has the same state (nothing or not) as the source object. If the
-     *  source contains an object (not nothing) then the object is copy constructed into this optional. */
-    Optional(const Optional &other) {
-        isEmpty_ = other.isEmpty_;
-        if (!isEmpty_) {
-            const Value &otherValue = *other;
-            new (address()) Value(otherValue);
-       }
-    }
-
-    /** Destructor.
-     *
-     *  The destructor invokes the destructor for the value if a value is stored, otherwise it does nothing. */
-    ~Optional() {
-        if (!isEmpty_) {
-            Value &thisValue = **this;
-            thisValue.~Value();
-        }
-    }
+    // The copy constructor, destructor, and copy assignment operator are those of the storage. If this optional contains a
+    // value, then copying uses the value's copy constructor or assignment operator and destruction calls its destructor.
 
     /** Value assignment.
      *
      *  Assigns the @p value to this optional. If this optional previously contained a value then the @ref Value assignment
      *  operator is used, otherwise the @ref Value copy constructor is used. */
     Optional& operator=(const Value &value) {
-        if (isEmpty_) {
-            new (address()) Value(value);
-        } else {
-            Value &thisValue = **this;
-            thisValue = value;
-        }
-        isEmpty_ = false;
+        this->assign(value);
         return *this;
     }
 
@@ -138,38 +229,10 @@ public:
      *  Assigns nothing to this optional.  If this optional previously contained a value then the value's destructor is
      *  called. */
     Optional& operator=(const Nothing&) {
-        if (!isEmpty_) {
-            Value &thisValue = **this;
-            thisValue.~Value();
-        }
-        isEmpty_ = true;
+        this->clear();
         return *this;
     }
     
-    /** Optional assignment.
-     *
-     *  Causes this optional to contain nothing or a copy of the @p other value depending on whether @p other contains a value
-     *  or not.  If this didn't contain a value but @p other did, then the @ref Value copy constructor is used; if both
-     *  contained a value then the @ref Value assignment operator is used; if this contained a value but @p other doesn't, then
-     *  the @ref Value destructor is called. */
-    Optional& operator=(const Optional &other) {
-        if (isEmpty_ && !other.isEmpty_) {
-            const Value &otherValue = *other;
-            new (address()) Value(otherValue);
-        } else if (!isEmpty_) {
-            if (other.isEmpty_) {
-                Value &thisValue = **this;
-                thisValue.~Value();
-            } else {
-                Value &thisValue = **this;
-                const Value &otherValue = *other;
-                thisValue = otherValue;
-            }
-        }
-        isEmpty_ = other.isEmpty_;
-        return *this;
-    }
-
     /** Reset as if default-constructed. */
     void reset() {
         *this = Nothing();
@@ -181,21 +244,19 @@ public:
      *  <code>std::domain_error</code> is thrown (the value is not in the container's domain).
      *
      *  @{ */
-    const Value& operator*() const {
+    constexpr const Value& operator*() const {
         return get();
     }
     Value& operator*() {
         return get();
     }
-    const Value& get() const {
-        if (isEmpty_)
-            throw std::domain_error("dereferenced nothing");
-        return *reinterpret_cast<const Value*>(address());
+    constexpr const Value& get() const {
+        return isEmpty_ ? throw std::domain_error("dereferenced nothing") : this->value();
     }
     Value& get() {
         if (isEmpty_)
             throw std::domain_error("dereferenced nothing");
-        return *reinterpret_cast<Value*>(address());
+        return this->value();
     }
     /** @} */
 
@@ -205,7 +266,7 @@ public:
      *  is thrown (the value is not in the container's domain).
      *
      *  @{ */
-    const Value* operator->() const {
+    constexpr const Value* operator->() const {
         return &get();
     }
     Value* operator->() {
@@ -225,8 +286,8 @@ public:
      * @endcode
      *
      *  @{ */
-    const Value& orElse(const Value &dflt) const {
-        return isEmpty_ ? dflt : **this;
+    constexpr const Value& orElse(const Value &dflt) const {
+        return isEmpty_ ? dflt : this->value();
     }
     const Value& orElse(Value &dflt) {
         return isEmpty_ ? dflt : **this;
@@ -263,8 +324,8 @@ public:
      *  std::cerr <<"baz is " <<baz.orDefault() <<"\n";
      * @endcode
      */
-    Value orDefault() const {
-        return isEmpty_ ? Value() : **this;
+    constexpr Value orDefault() const {
+        return isEmpty_ ? Value() : this->value();
     }
 
     /** Conditionally save a value.
@@ -311,7 +372,7 @@ public:
     bool isEqual(const Value &other) const {
         return !isEmpty_ && get()==other;
     }
-    bool isEqual(const Nothing&) const {
+    constexpr bool isEqual(const Nothing&) const {
         return isEmpty_;
     }
     /** @} */
@@ -333,7 +394,7 @@ public:
      *      //this is reached
      *   }
      *  @endcode */
-    operator unspecified_bool() const {
+    constexpr operator unspecified_bool() const {
         return isEmpty_ ? 0 : &Optional::this_type_does_not_support_comparisons;
     }
 };
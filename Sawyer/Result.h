@@ -47,20 +47,16 @@ public:
     Ok() = delete;
 
     /** Copy constructor. */
-    Ok(const Ok &other)
-        : ok_(other.ok_) {}
+    Ok(const Ok &other) = default;
 
     /** Construct from an value. */
-    explicit Ok(const Value &ok)
+    constexpr explicit Ok(const Value &ok)
         : ok_(ok) {}
 
     /** Assignment.
      *
      * @{ */
-    Ok& operator=(const Ok &other) {
-        ok_ = other.ok_;
-        return *this;
-    }
+    Ok& operator=(const Ok &other) = default;
     Ok& operator=(const Value &ok) {
         ok_ = ok;
         return *this;
@@ -68,12 +64,12 @@ public:
     /** @} */
 
     /** Dereference to obtain value. */
-    const Value& operator*() const {
+    constexpr const Value& operator*() const {
         return ok_;
     }
 
     /** Dereference to obtain pointer. */
-    const Value* operator->() const {
+    constexpr const Value* operator->() const {
         return &ok_;
     }
 };
@@ -158,20 +154,16 @@ public:
     Error() = delete;
 
     /** Copy constructor. */
-    Error(const Error &other)
-        : error_(other.error_) {}
+    Error(const Error &other) = default;
 
     /** Construct from a value. */
-    explicit Error(const E &error)
+    constexpr explicit Error(const E &error)
         : error_(error) {}
 
     /** Assignment.
      *
      * @{ */
-    Error& operator=(const Error &other) {
-        error_ = other.error_;
-        return *this;
-    }
+    Error& operator=(const Error &other) = default;
     Error& operator=(const Value &error) {
         error_ = error;
         return *this;
@@ -179,12 +171,12 @@ public:
     /** @} */
 
     /** Dereference to obtain error. */
-    const Value& operator*() const {
+    constexpr const Value& operator*() const {
         return error_;
     }
 
     /** Dereference to obtain pointer to error. */
-    const Value* operator->() const {
+    constexpr const Value* operator->() const {
         return &error_;
     }
 };
@@ -258,7 +250,59 @@ inline Error<std::string> makeError(char *s) {
     return Error<std::string>(std::string(s));
 }
 
-/** Result containing a value or an error. */
+namespace Detail {
+
+// Storage for a Result whose value or error type is not trivial.
+template<class T, class E, bool = IsTrivialPayload<T>::value && IsTrivialPayload<E>::value>
+class ResultStorage {
+    boost::variant<Ok<T>, Error<E>> result_;
+
+public:
+    explicit ResultStorage(const Ok<T> &ok): result_(ok) {}
+    explicit ResultStorage(const Error<E> &error): result_(error) {}
+
+    bool isOk() const { return result_.which() == 0; }
+    const T& okValue() const { return *boost::get<Ok<T>>(result_); }
+    const E& errorValue() const { return *boost::get<Error<E>>(result_); }
+    void setOk(const T &ok) { result_ = Ok<T>(ok); }
+    void setError(const E &error) { result_ = Error<E>(error); }
+};
+
+// Storage for a Result whose value and error types are both trivial. The implicit copy constructor, assignment operator, and
+// destructor are all trivial, so the Result is trivially copyable and its constructors are constexpr.
+template<class T, class E>
+class ResultStorage<T, E, true> {
+    union {
+        T ok_;
+        E error_;
+    };
+    bool isOk_;
+
+public:
+    constexpr explicit ResultStorage(const Ok<T> &ok): ok_(*ok), isOk_(true) {}
+    constexpr explicit ResultStorage(const Error<E> &error): error_(*error), isOk_(false) {}
+
+    constexpr bool isOk() const { return isOk_; }
+    constexpr const T& okValue() const { return ok_; }
+    constexpr const E& errorValue() const { return error_; }
+
+    void setOk(const T &ok) {
+        ok_ = ok;
+        isOk_ = true;
+    }
+
+    void setError(const E &error) {
+        error_ = error;
+        isOk_ = false;
+    }
+};
+
+} // namespace
+
+/** Result containing a value or an error.
+ *
+ *  If both the value type and the error type are trivially copyable, then so is the result, its constructors and most of its
+ *  observers are @c constexpr, and it can be passed and returned in registers. */
 template<class T, class E>
 class Result {
 public:
@@ -268,7 +312,7 @@ public:
     using ErrorType = Error<E>;
 
 private:
-    boost::variant<Ok<T>, Error<E>> result_;
+    Detail::ResultStorage<T, E> result_;
 
 private:
     friend class boost::serialization::access;
@@ -290,11 +334,11 @@ private:
         if (isOk) {
             T ok;
             s >>boost::serialization::make_nvp("ok", ok);
-            result_ = OkType(ok);
+            result_.setOk(ok);
         } else {
             E error;
             s >>boost::serialization::make_nvp("error", error);
-            result_ = ErrorType(error);
+            result_.setError(error);
         }
     }
 
@@ -302,24 +346,24 @@ private:
 
 public:
     template<class U = T>
-    /*implicit*/ Result(const Ok<U> &ok)
+    constexpr /*implicit*/ Result(const Ok<U> &ok)
         : result_(OkType(*ok)) {}
 
     template<class F = E>
-    /*implicit*/ Result(const Error<F> &error)
+    constexpr /*implicit*/ Result(const Error<F> &error)
         : result_(ErrorType(*error)) {}
 
     /** Assign an @ref Ok value to this result. */
     template<class U = T>
     Result& operator=(const Ok<U> &ok) {
-        result_ = OkType(*ok);
+        result_.setOk(*ok);
         return *this;
     }
 
     /** Assign an @ref Error value to this result. */
     template<class F = E>
     Result& operator=(const Error<F> &error) {
-        result_ = ErrorType(*error);
+        result_.setError(*error);
         return *this;
     }
 
@@ -363,39 +407,31 @@ public:
     /** Returns true if the result is okay.
      *
      * @{ */
-    bool isOk() const {
-        return result_.which() == 0;
+    constexpr bool isOk() const {
+        return result_.isOk();
     }
-    explicit operator bool() const {
+    constexpr explicit operator bool() const {
         return isOk();
     }
     /** @} */
 
     /** Returns true if the result is an error. */
-    bool isError() const {
+    constexpr bool isError() const {
         return !isOk();
     }
 
     /** Convert to Optional<T>.
      *
      *  If this result is okay, then return the result, otherwise return nothing. */
-    const Sawyer::Optional<T> ok() const {
-        if (isOk()) {
-            return *boost::get<OkType>(result_);
-        } else {
-            return Sawyer::Nothing();
-        }
+    constexpr const Sawyer::Optional<T> ok() const {
+        return isOk() ? Sawyer::Optional<T>(result_.okValue()) : Sawyer::Optional<T>();
     }
 
     /** Convert to Optional<E>.
      *
      *  If this result is an error, then return the error, otherwise return nothing. */
-    const Sawyer::Optional<E> error() const {
-        if (isOk()) {
-            return Sawyer::Nothing();
-        } else {
-            return *boost::get<ErrorType>(result_);
-        }
+    constexpr const Sawyer::Optional<E> error() const {
+        return isOk() ? Sawyer::Optional<E>() : Sawyer::Optional<E>(result_.errorValue());
     }
 
     /** Returns the success value or throws an exception.
@@ -403,7 +439,7 @@ public:
      *  If this result is okay, then returns its value, otherwise throws an <code>std::runtime_error</code> with the specified string. */
     const T& expect(const std::string &mesg) const {
         if (isOk()) {
-            return *boost::get<OkType>(result_);
+            return result_.okValue();
         } else {
             throw std::runtime_error(mesg);
         }
@@ -414,17 +450,17 @@ public:
      *  If this result is okay, then returns its value, otherwise throws an <code>std::runtime_error</code>.
      *
      * @{ */
-    const T& unwrap() const {
-        return expect("result is not okay");
+    constexpr const T& unwrap() const {
+        return isOk() ? result_.okValue() : throw std::runtime_error("result is not okay");
     }
-    const T& operator*() const {
+    constexpr const T& operator*() const {
         return unwrap();
     }
     /** @} */
 
     /** Returns the contained @ref Ok value or a provided default. */
-    const T orElse(const T &dflt) const {
-        return isOk() ? unwrap() : dflt;
+    constexpr const T orElse(const T &dflt) const {
+        return isOk() ? result_.okValue() : dflt;
     }
 
     /** Returns the contained @ref Ok value, or calls a function.
@@ -447,7 +483,7 @@ public:
     template<class F>
     const Result<T, F> orElse(const Result<T, F> &other) const {
         if (isOk()) {
-            return boost::get<OkType>(result_);
+            return OkType(result_.okValue());
         } else {
             return other;
         }
@@ -504,7 +540,7 @@ public:
         if (isOk()) {
             return other;
         } else {
-            return boost::get<ErrorType>(result_);
+            return ErrorType(result_.errorValue());
         }
     }
 
@@ -515,15 +551,15 @@ public:
         if (isOk()) {
             throw std::runtime_error(mesg);
         } else {
-            return *boost::get<ErrorType>(result_);
+            return result_.errorValue();
         }
     }
 
     /** Returns the error value or throws an exception.
      *
      *  If this result is an error, then returns the error, otherwise throws an <code>std::runtime_error</code>. */
-    const E& unwrapError() const {
-        return expectError("result is not an error");
+    constexpr const E& unwrapError() const {
+        return isOk() ? throw std::runtime_error("result is not an error") : result_.errorValue();
     }
 
     /** Returns true if this result contains the specified okay value. */
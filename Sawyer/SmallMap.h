@@ -0,0 +1,435 @@
+#ifndef Sawyer_Container_SmallMap_H
+#define Sawyer_Container_SmallMap_H
+
+#include <Sawyer/Assert.h>
+#include <Sawyer/Interval.h>
+#include <Sawyer/Optional.h>
+#include <Sawyer/Sawyer.h>
+#include <Sawyer/SmallSet.h>
+
+#include <boost/iterator/iterator_adaptor.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <stdexcept>
+
+namespace Sawyer {
+namespace Container {
+
+/** %Container associating values with keys, optimized for few nodes.
+ *
+ *  This container has the same interface as @ref Map, but instead of allocating a tree node for each key/value pair it keeps
+ *  its nodes sorted by key in a contiguous array, the first @p N of which are stored inside the map object itself. See @ref
+ *  SmallSet for the trade-offs. In particular, inserting or erasing a node invalidates all iterators and references to nodes
+ *  of the map. */
+template<class K, class T, size_t N = 8, class Cmp = std::less<K> >
+class SmallMap {
+public:
+    typedef K Key;                                      /**< Type for keys. */
+    typedef T Value;                                    /**< Type for values associated with each key. */
+    typedef Cmp Comparator;                             /**< Type of comparator. */
+
+    /** %Type for stored nodes.
+     *
+     *  A storage node contains the key and its associated value. */
+    class Node {
+        friend class SmallMap;
+        Key key_;
+        Value value_;
+    public:
+        Node(const Key &key, const Value &value): key_(key), value_(value) {}
+
+        /** Key part of key/value node.
+         *
+         *  Returns the key part of a key/value node. Keys are not mutable when they are part of a map. */
+        const Key& key() const { return key_; }
+
+        /** Value part of key/value node.
+         *
+         *  Returns a reference to the value part of a key/value node.
+         *
+         * @{ */
+        Value& value() { return value_; }
+        const Value& value() const { return value_; }
+        /** @} */
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Iterators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    typedef Node* NodeIterator;                         /**< Iterates over nodes. */
+    typedef const Node* ConstNodeIterator;              /**< Iterates over nodes of a const map. */
+
+    /** Iterates over keys. */
+    class ConstKeyIterator: public boost::iterator_adaptor<ConstKeyIterator, const Node*, const Key> {
+    public:
+        ConstKeyIterator() {}
+        ConstKeyIterator(const Node *node) /*implicit*/: ConstKeyIterator::iterator_adaptor_(node) {}
+    private:
+        friend class boost::iterator_core_access;
+        const Key& dereference() const { return this->base()->key(); }
+    };
+
+    /** Iterates over values. */
+    class ValueIterator: public boost::iterator_adaptor<ValueIterator, Node*, Value> {
+    public:
+        ValueIterator() {}
+        ValueIterator(Node *node) /*implicit*/: ValueIterator::iterator_adaptor_(node) {}
+    private:
+        friend class boost::iterator_core_access;
+        Value& dereference() const { return this->base()->value(); }
+    };
+
+    /** Iterates over values of a const map. */
+    class ConstValueIterator: public boost::iterator_adaptor<ConstValueIterator, const Node*, const Value> {
+    public:
+        ConstValueIterator() {}
+        ConstValueIterator(const Node *node) /*implicit*/: ConstValueIterator::iterator_adaptor_(node) {}
+        ConstValueIterator(const ValueIterator &other) /*implicit*/: ConstValueIterator::iterator_adaptor_(other.base()) {}
+    private:
+        friend class boost::iterator_core_access;
+        const Value& dereference() const { return this->base()->value(); }
+    };
+
+private:
+    Detail::SmallStorage<Node, N> nodes_;
+    Comparator comparator_;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Constructors
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Default constructor.
+     *
+     *  Creates an empty map. */
+    explicit SmallMap(const Comparator &comparator = Comparator())
+        : comparator_(comparator) {}
+
+    /** Copy constructor. */
+    SmallMap(const SmallMap &other)
+        : nodes_(other.nodes_), comparator_(other.comparator_) {}
+
+    /** Move constructor.
+     *
+     *  The @p other map is left empty. */
+    SmallMap(SmallMap &&other)
+        : nodes_(std::move(other.nodes_)), comparator_(other.comparator_) {}
+
+    /** Make this map be a copy of another map. */
+    SmallMap& operator=(const SmallMap &other) {
+        nodes_ = other.nodes_;
+        comparator_ = other.comparator_;
+        return *this;
+    }
+
+    /** Move another map into this one.
+     *
+     *  The @p other map is left empty. */
+    SmallMap& operator=(SmallMap &&other) {
+        nodes_ = std::move(other.nodes_);
+        comparator_ = other.comparator_;
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Iteration
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Iterators for container nodes.
+     *
+     *  Returns a range of iterators that traverse the nodes in order of their keys.
+     *
+     * @{ */
+    boost::iterator_range<NodeIterator> nodes() {
+        return boost::iterator_range<NodeIterator>(nodes_.data(), nodes_.data() + nodes_.size());
+    }
+    boost::iterator_range<ConstNodeIterator> nodes() const {
+        return boost::iterator_range<ConstNodeIterator>(nodes_.data(), nodes_.data() + nodes_.size());
+    }
+    /** @} */
+
+    /** Iterators for container keys.
+     *
+     *  Returns a range of iterators that traverse the keys in order. */
+    boost::iterator_range<ConstKeyIterator> keys() const {
+        return boost::iterator_range<ConstKeyIterator>(nodes().begin(), nodes().end());
+    }
+
+    /** Iterators for container values.
+     *
+     *  Returns a range of iterators that traverse the values in order of their keys.
+     *
+     * @{ */
+    boost::iterator_range<ValueIterator> values() {
+        return boost::iterator_range<ValueIterator>(nodes().begin(), nodes().end());
+    }
+    boost::iterator_range<ConstValueIterator> values() const {
+        return boost::iterator_range<ConstValueIterator>(nodes().begin(), nodes().end());
+    }
+    /** @} */
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Size and capacity
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Determines whether this container is empty. */
+    bool isEmpty() const {
+        return nodes_.size() == 0;
+    }
+
+    /** Number of nodes, keys, or values in this container. */
+    size_t size() const {
+        return nodes_.size();
+    }
+
+    /** Whether the nodes are stored inline.
+     *
+     *  Returns true if the nodes are stored inside this object, false if they have been moved to the heap. */
+    bool isInline() const {
+        return nodes_.isInline();
+    }
+
+    /** Returns the minimum key.  The map must not be empty. */
+    Key least() const {
+        ASSERT_forbid(isEmpty());
+        return nodes_.data()[0].key();
+    }
+
+    /** Returns the maximum key.  The map must not be empty. */
+    Key greatest() const {
+        ASSERT_forbid(isEmpty());
+        return nodes_.data()[nodes_.size() - 1].key();
+    }
+
+    /** Returns the range of keys in this map.
+     *
+     *  The return value is an interval containing the least and greatest keys, inclusive.  If the map is empty then an empty
+     *  interval is returned. */
+    Interval<Key> hull() const {
+        return isEmpty() ? Interval<Key>() : Interval<Key>::hull(least(), greatest());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Searching
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Find a node by key.
+     *
+     *  Looks for a node whose key is equal to the specified @p key and returns an iterator to that node, or the end
+     *  iterator if no such node exists.
+     *
+     * @{ */
+    NodeIterator find(const Key &key) {
+        size_t i = lowerIndex(key);
+        return isEqual(i, key) ? nodes_.data() + i : nodes().end();
+    }
+    ConstNodeIterator find(const Key &key) const {
+        size_t i = lowerIndex(key);
+        return isEqual(i, key) ? nodes_.data() + i : nodes().end();
+    }
+    /** @} */
+
+    /** Determine if a key exists. */
+    bool exists(const Key &key) const {
+        return isEqual(lowerIndex(key), key);
+    }
+
+    /** Find a node close to a key.
+     *
+     *  Finds the first node whose key is equal to or larger than the specified key and returns an iterator to that node. If no
+     *  such node exists, then the end iterator is returned.
+     *
+     * @{ */
+    NodeIterator lowerBound(const Key &key) {
+        return nodes_.data() + lowerIndex(key);
+    }
+    ConstNodeIterator lowerBound(const Key &key) const {
+        return nodes_.data() + lowerIndex(key);
+    }
+    /** @} */
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Accessors
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Return a reference to an existing value.
+     *
+     *  If the @p key is not part of this map's domain then an <code>std:domain_error</code> is thrown.
+     *
+     *  @{ */
+    Value& operator[](const Key &key) {
+        return get(key);
+    }
+    const Value& operator[](const Key &key) const {
+        return get(key);
+    }
+    /** @} */
+
+    /** Lookup and return an existing value.
+     *
+     *  If the @p key is not part of this map's domain then an <code>std:domain_error</code> is thrown.
+     *
+     *  @{ */
+    Value& get(const Key &key) {
+        size_t i = lowerIndex(key);
+        if (!isEqual(i, key))
+            throw std::domain_error("key lookup failure; key is not in map domain");
+        return nodes_.data()[i].value();
+    }
+    const Value& get(const Key &key) const {
+        size_t i = lowerIndex(key);
+        if (!isEqual(i, key))
+            throw std::domain_error("key lookup failure; key is not in map domain");
+        return nodes_.data()[i].value();
+    }
+    /** @} */
+
+    /** Lookup and return a value or nothing. */
+    Optional<Value> getOptional(const Key &key) const {
+        size_t i = lowerIndex(key);
+        return isEqual(i, key) ? Optional<Value>(nodes_.data()[i].value()) : Optional<Value>();
+    }
+
+    /** Lookup and return a value or something else.
+     *
+     * @{ */
+    Value& getOrElse(const Key &key, Value &dflt) {
+        size_t i = lowerIndex(key);
+        return isEqual(i, key) ? nodes_.data()[i].value() : dflt;
+    }
+    const Value& getOrElse(const Key &key, const Value &dflt) const {
+        size_t i = lowerIndex(key);
+        return isEqual(i, key) ? nodes_.data()[i].value() : dflt;
+    }
+    /** @} */
+
+    /** Lookup and return a value or a default. */
+    const Value& getOrDefault(const Key &key) const {
+        static const Value dflt;
+        return getOrElse(key, dflt);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Mutators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Insert or update a key/value pair.
+     *
+     *  Inserts the key/value pair into the container. If a previous node already had the same key then its value is replaced. */
+    SmallMap& insert(const Key &key, const Value &value) {
+        size_t i = lowerIndex(key);
+        if (isEqual(i, key)) {
+            nodes_.data()[i].value() = value;
+        } else {
+            nodes_.insertAt(i, Node(key, value));
+        }
+        return *this;
+    }
+
+    /** Insert or update a key with a default value. */
+    SmallMap& insertDefault(const Key &key) {
+        return insert(key, Value());
+    }
+
+    /** Insert multiple values.
+     *
+     *  Inserts copies of the nodes in the specified node iterator range. The iterators must iterate over objects that have
+     *  <code>key</code> and <code>value</code> methods.
+     *
+     * @{ */
+    template<class OtherNodeIterator>
+    SmallMap& insertMultiple(const OtherNodeIterator &begin, const OtherNodeIterator &end) {
+        for (OtherNodeIterator otherIter=begin; otherIter!=end; ++otherIter)
+            insert(Key(otherIter->key()), Value(otherIter->value()));
+        return *this;
+    }
+    template<class OtherNodeIterator>
+    SmallMap& insertMultiple(const boost::iterator_range<OtherNodeIterator> &range) {
+        return insertMultiple(range.begin(), range.end());
+    }
+    /** @} */
+
+    /** Conditionally insert a new key/value pair.
+     *
+     *  Inserts the key/value pair into the container if the container does not yet have a node with the same key. The return
+     *  value is a reference to the value that is in the container, which is valid until the map is next modified. */
+    Value& insertMaybe(const Key &key, const Value &value) {
+        size_t i = lowerIndex(key);
+        if (!isEqual(i, key))
+            nodes_.insertAt(i, Node(key, value));
+        return nodes_.data()[i].value();
+    }
+
+    /** Conditionally insert a new key with default value. */
+    Value& insertMaybeDefault(const Key &key) {
+        return insertMaybe(key, Value());
+    }
+
+    /** Remove all nodes.
+     *
+     *  All nodes are removed from this container and any heap storage is released. */
+    SmallMap& clear() {
+        nodes_.clear();
+        return *this;
+    }
+
+    /** Remove a node with specified key.
+     *
+     *  Removes the node whose key is equal to the specified key, or does nothing if no such node exists. */
+    SmallMap& erase(const Key &key) {
+        size_t i = lowerIndex(key);
+        if (isEqual(i, key))
+            nodes_.eraseAt(i);
+        return *this;
+    }
+
+    /** Remove keys stored in another map. */
+    template<class OtherKeyIterator>
+    SmallMap& eraseMultiple(const boost::iterator_range<OtherKeyIterator> &range) {
+        for (OtherKeyIterator otherIter=range.begin(); otherIter!=range.end(); ++otherIter)
+            erase(Key(*otherIter));
+        return *this;
+    }
+
+    /** Remove a node by iterator.
+     *
+     *  Removes the node referenced by @p iter. The iterator must reference a valid node in this container. */
+    SmallMap& eraseAt(const ConstNodeIterator &iter) {
+        ASSERT_require(iter >= nodes_.data() && iter < nodes_.data() + nodes_.size());
+        nodes_.eraseAt(iter - nodes_.data());
+        return *this;
+    }
+
+private:
+    // Index of the first node whose key is not less than key, or size() if there is none.
+    size_t lowerIndex(const Key &key) const {
+        const Node *data = nodes_.data();
+        const size_t n = nodes_.size();
+        if (n <= N) {
+            size_t i = 0;
+            while (i < n && comparator_(data[i].key_, key))
+                ++i;
+            return i;
+        } else {
+            size_t lo = 0, hi = n;
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (comparator_(data[mid].key_, key)) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            return lo;
+        }
+    }
+
+    // Whether the node at index i exists and has the specified key, given that i was returned by lowerIndex.
+    bool isEqual(size_t i, const Key &key) const {
+        return i < nodes_.size() && !comparator_(key, nodes_.data()[i].key_);
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,587 @@
+#ifndef Sawyer_Container_SmallSet_H
+#define Sawyer_Container_SmallSet_H
+
+#include <Sawyer/Assert.h>
+#include <Sawyer/Interval.h>
+#include <Sawyer/Sawyer.h>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/serialization/access.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Sawyer {
+namespace Container {
+
+namespace Detail {
+
+// Contiguous storage for values that holds up to N values within the object itself and moves them to the heap when it needs
+// more room. It knows nothing about ordering; the containers built on it decide where each value goes.
+template<class T, size_t N>
+class SmallStorage {
+    static_assert(N > 0, "inline capacity must be positive");
+
+    T *data_;                                           // inline_ or a heap array
+    size_t size_;                                       // number of initialized values
+    size_t capacity_;                                   // N when inline, otherwise size of the heap array
+    typename std::aligned_storage<N * sizeof(T), alignof(T)>::type inline_;
+
+public:
+    SmallStorage()
+        : data_(inlineData()), size_(0), capacity_(N) {}
+
+    SmallStorage(const SmallStorage &other)
+        : data_(inlineData()), size_(0), capacity_(N) {
+        reserve(other.size_);
+        std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+        size_ = other.size_;
+    }
+
+    SmallStorage(SmallStorage &&other)
+        : data_(inlineData()), size_(0), capacity_(N) {
+        steal(other);
+    }
+
+    ~SmallStorage() {
+        clear();
+    }
+
+    SmallStorage& operator=(const SmallStorage &other) {
+        if (this != &other) {
+            SmallStorage tmp(other);
+            clear();
+            steal(tmp);
+        }
+        return *this;
+    }
+
+    SmallStorage& operator=(SmallStorage &&other) {
+        if (this != &other) {
+            clear();
+            steal(other);
+        }
+        return *this;
+    }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t capacity() const { return capacity_; }
+    bool isInline() const { return data_ == inlineData(); }
+
+    // Destroy all values and return to inline storage.
+    void clear() {
+        truncate(0);
+        if (!isInline()) {
+            std::allocator<T>().deallocate(data_, capacity_);
+            data_ = inlineData();
+            capacity_ = N;
+        }
+    }
+
+    // Destroy the values at position n and later, keeping the capacity.
+    void truncate(size_t n) {
+        ASSERT_require(n <= size_);
+        for (size_t i = n; i < size_; ++i)
+            data_[i].~T();
+        size_ = n;
+    }
+
+    // Make room for at least n values.
+    void reserve(size_t n) {
+        if (n > capacity_)
+            reallocate(std::max(n, 2 * capacity_));
+    }
+
+    // Insert a value at position i, shifting later values up by one.
+    void insertAt(size_t i, T value) {
+        ASSERT_require(i <= size_);
+        reserve(size_ + 1);
+        if (i == size_) {
+            new (data_ + size_) T(std::move(value));
+        } else {
+            new (data_ + size_) T(std::move(data_[size_ - 1]));
+            std::move_backward(data_ + i, data_ + size_ - 1, data_ + size_);
+            data_[i] = std::move(value);
+        }
+        ++size_;
+    }
+
+    // Append a value.
+    void pushBack(T value) {
+        reserve(size_ + 1);
+        new (data_ + size_) T(std::move(value));
+        ++size_;
+    }
+
+    // Erase the value at position i, shifting later values down by one.
+    void eraseAt(size_t i) {
+        ASSERT_require(i < size_);
+        std::move(data_ + i + 1, data_ + size_, data_ + i);
+        truncate(size_ - 1);
+    }
+
+private:
+    T* inlineData() { return reinterpret_cast<T*>(&inline_); }
+    const T* inlineData() const { return reinterpret_cast<const T*>(&inline_); }
+
+    void reallocate(size_t newCapacity) {
+        ASSERT_require(newCapacity >= size_);
+        T *newData = std::allocator<T>().allocate(newCapacity);
+        for (size_t i = 0; i < size_; ++i) {
+            new (newData + i) T(std::move(data_[i]));
+            data_[i].~T();
+        }
+        if (!isInline())
+            std::allocator<T>().deallocate(data_, capacity_);
+        data_ = newData;
+        capacity_ = newCapacity;
+    }
+
+    // Take the values from other, which is left empty. This storage must be empty and inline.
+    void steal(SmallStorage &other) {
+        ASSERT_require(size_ == 0 && isInline());
+        if (other.isInline()) {
+            for (size_t i = 0; i < other.size_; ++i)
+                new (data_ + i) T(std::move(other.data_[i]));
+            size_ = other.size_;
+            other.truncate(0);
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+};
+
+} // namespace
+
+/** Ordered set of values optimized for few members.
+ *
+ *  This container has the same interface as @ref Set, but instead of allocating a tree node for each member it keeps its
+ *  members sorted in a contiguous array. The first @p N members are stored inside the set object itself, so a set that never
+ *  grows beyond @p N members never allocates memory. When a set grows beyond that, its members are moved to a heap array whose
+ *  capacity doubles as needed.
+ *
+ *  Lookups search the array linearly while the members are inline and use a binary search after that. Insertion and erasure
+ *  shift the members that follow the affected position, which is cheap for the small sets this container is intended for, but
+ *  makes these operations linear in the size of the set. Large sets that change often should use @ref Set instead.
+ *
+ *  Unlike @ref Set, inserting or erasing a member invalidates all iterators and references to members of the set. */
+template<typename T, size_t N = 8, class C = std::less<T> >
+class SmallSet {
+public:
+    typedef T Value;                                    /**< Type of values stored in this set. */
+    typedef C Comparator;                               /**< How to compare values with each other. */
+    typedef const Value* ConstIterator;                 /**< Iterator for traversing values stored in the set. */
+
+private:
+    Detail::SmallStorage<Value, N> storage_;
+    Comparator comparator_;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Serialization
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+    friend class boost::serialization::access;
+
+    template<class S>
+    void save(S &s, const unsigned /*version*/) const {
+        std::vector<Value> values(storage_.data(), storage_.data() + storage_.size());
+        s <<BOOST_SERIALIZATION_NVP(values);
+    }
+
+    template<class S>
+    void load(S &s, const unsigned /*version*/) {
+        std::vector<Value> values;
+        s >>BOOST_SERIALIZATION_NVP(values);
+        clear();
+        storage_.reserve(values.size());
+        for (Value &value: values)
+            storage_.pushBack(std::move(value));
+    }
+
+    BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Construction
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Default constructor.
+     *
+     *  Constructs a new set containing no values. */
+    explicit SmallSet(const Comparator &comparator = Comparator())
+        : comparator_(comparator) {}
+
+    /** Singleton constructor.
+     *
+     *  Constructs a singleton set having only the specified value. */
+    SmallSet(const Value &value) /*implicit*/ {
+        storage_.pushBack(value);
+    }
+
+    /** Iterative constructor.
+     *
+     *  Constructs a new set and copies values into the set.
+     *
+     * @{ */
+    template<class InputIterator>
+    SmallSet(InputIterator begin, InputIterator end, const Comparator &comparator = Comparator())
+        : comparator_(comparator) {
+        for (/*void*/; begin != end; ++begin)
+            insert(Value(*begin));
+    }
+
+    template<class InputIterator>
+    explicit SmallSet(const boost::iterator_range<InputIterator> &range, const Comparator &comparator = Comparator())
+        : comparator_(comparator) {
+        for (InputIterator iter = range.begin(); iter != range.end(); ++iter)
+            insert(Value(*iter));
+    }
+    /** @} */
+
+    /** Copy constructor. */
+    SmallSet(const SmallSet &other)
+        : storage_(other.storage_), comparator_(other.comparator_) {}
+
+    /** Move constructor.
+     *
+     *  The @p other set is left empty. */
+    SmallSet(SmallSet &&other)
+        : storage_(std::move(other.storage_)), comparator_(other.comparator_) {}
+
+    /** Assignment operator. */
+    SmallSet& operator=(const SmallSet &other) {
+        storage_ = other.storage_;
+        comparator_ = other.comparator_;
+        return *this;
+    }
+
+    /** Move assignment.
+     *
+     *  The @p other set is left empty. */
+    SmallSet& operator=(SmallSet &&other) {
+        storage_ = std::move(other.storage_);
+        comparator_ = other.comparator_;
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Iterators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Value iterator range.
+     *
+     *  Returns an iterator range that covers all values in the set in sorted order. */
+    boost::iterator_range<ConstIterator> values() const {
+        return boost::iterator_range<ConstIterator>(storage_.data(), storage_.data() + storage_.size());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Predicates and queries
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Whether the set is empty.
+     *
+     *  Returns true if the set is empty, false if not empty. */
+    bool isEmpty() const {
+        return storage_.size() == 0;
+    }
+
+    /** Whether a value exists.
+     *
+     *  Returns true if @p value is a member of the set, false if not a member. */
+    bool exists(const Value &value) const {
+        size_t i = lowerIndex(value);
+        return i < storage_.size() && !comparator_(value, storage_.data()[i]);
+    }
+
+    /** Whether any value exists.
+     *
+     *  Returns true if any of the specified values exist in this set. */
+    bool existsAny(const SmallSet &other) const {
+        for (const Value &otherValue: other.values()) {
+            if (exists(otherValue))
+                return true;
+        }
+        return false;
+    }
+
+    /** Whether all values exist.
+     *
+     *  Returns true if all specified values exist in this set. */
+    bool existsAll(const SmallSet &other) const {
+        for (const Value &otherValue: other.values()) {
+            if (!exists(otherValue))
+                return false;
+        }
+        return true;
+    }
+
+    /** Size of the set.
+     *
+     *  Returns the number of values that are members of this set. */
+    size_t size() const {
+        return storage_.size();
+    }
+
+    /** Whether the members are stored inline.
+     *
+     *  Returns true if the members are stored inside this object, false if they have been moved to the heap. */
+    bool isInline() const {
+        return storage_.isInline();
+    }
+
+    /** Smallest member.
+     *
+     *  Returns the smallest member of the set. The set must not be empty. */
+    Value least() const {
+        ASSERT_forbid(isEmpty());
+        return storage_.data()[0];
+    }
+
+    /** Largest member.
+     *
+     *  Returns the largest member of the set. The set must not be empty. */
+    Value greatest() const {
+        ASSERT_forbid(isEmpty());
+        return storage_.data()[storage_.size() - 1];
+    }
+
+    /** Range of members.
+     *
+     *  Returns a range having the minimum and maximum members of the set. */
+    Interval<Value> hull() const {
+        if (isEmpty())
+            return Interval<Value>();
+        return Interval<Value>::hull(least(), greatest());
+    }
+
+    /** Whether two sets contain the same members.
+     *
+     *  Returns true if this set and @p other contain exactly the same members. */
+    bool operator==(const SmallSet &other) const {
+        return size() == other.size() && std::equal(values().begin(), values().end(), other.values().begin());
+    }
+
+    /** Whether two sets do not contain the same members.
+     *
+     *  Returns true if this set and the @p other set are not equal. */
+    bool operator!=(const SmallSet &other) const {
+        return !(*this == other);
+    }
+
+    /** Whether the set is non-empty.
+     *
+     *  Returns true if the set is not empty, false if empty. */
+    explicit operator bool() const {
+        return !isEmpty();
+    }
+
+    /** Whether the set is empty.
+     *
+     *  Returns true if the set is empty, false if not empty. */
+    bool operator!() const {
+        return isEmpty();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Mutators
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Insert a value.
+     *
+     *  Inserts @p value into the set. Returns true if the value was inserted, false if the value was already a member. */
+    bool insert(const Value &value) {
+        size_t i = lowerIndex(value);
+        if (i < storage_.size() && !comparator_(value, storage_.data()[i]))
+            return false;
+        storage_.insertAt(i, value);
+        return true;
+    }
+
+    /** Insert multiple values.
+     *
+     *  Inserts all specified values into this set. Returns true if any value was inserted, false if all the values were
+     *  already members of this set. */
+    bool insert(const SmallSet &values) {
+        size_t oldSize = size();
+        *this |= values;
+        return size() != oldSize;
+    }
+
+    /** Erase a value.
+     *
+     *  Erases @p value from the set. Returns true if the value was erased, false if the value was not a member. */
+    bool erase(const Value &value) {
+        size_t i = lowerIndex(value);
+        if (i == storage_.size() || comparator_(value, storage_.data()[i]))
+            return false;
+        storage_.eraseAt(i);
+        return true;
+    }
+
+    /** Erase multiple values.
+     *
+     *  Erases all specified values from this set. Returns true if any value was erased, false if none of the specified values
+     *  were members of this set. */
+    bool erase(const SmallSet &values) {
+        size_t oldSize = size();
+        *this -= values;
+        return size() != oldSize;
+    }
+
+    /** Erase all values.
+     *
+     *  Erases all values from the set so that the set becomes empty. Any heap storage is released. */
+    void clear() {
+        storage_.clear();
+    }
+
+    /** Intersects this set with another.
+     *
+     *  Removes those members of this set that are not in the @p other set. */
+    SmallSet& operator&=(const SmallSet &other) {
+        retain(other, true);
+        return *this;
+    }
+
+    /** Unions this set with another.
+     *
+     *  Adds those members of @p other that are not already members of this set. */
+    SmallSet& operator|=(const SmallSet &other) {
+        if (this == &other || other.isEmpty())
+            return *this;
+        if (other.size() == 1) {
+            insert(other.least());
+            return *this;
+        }
+
+        // Count the members of the union so that a union that fits inline stays inline, then merge the two sorted arrays into
+        // new storage.
+        const Value *a = storage_.data(), *aEnd = a + storage_.size();
+        const Value *b = other.storage_.data(), *bEnd = b + other.storage_.size();
+        size_t nMerged = storage_.size() + other.storage_.size();
+        while (a != aEnd && b != bEnd) {
+            if (comparator_(*a, *b)) {
+                ++a;
+            } else if (comparator_(*b, *a)) {
+                ++b;
+            } else {
+                ++a;
+                ++b;
+                --nMerged;
+            }
+        }
+        if (nMerged == size())
+            return *this;                               // other is a subset of this set
+
+        Detail::SmallStorage<Value, N> merged;
+        merged.reserve(nMerged);
+        a = storage_.data();
+        b = other.storage_.data();
+        while (a != aEnd && b != bEnd) {
+            if (comparator_(*a, *b)) {
+                merged.pushBack(*a++);
+            } else if (comparator_(*b, *a)) {
+                merged.pushBack(*b++);
+            } else {
+                merged.pushBack(*a++);
+                ++b;
+            }
+        }
+        for (/*void*/; a != aEnd; ++a)
+            merged.pushBack(*a);
+        for (/*void*/; b != bEnd; ++b)
+            merged.pushBack(*b);
+        storage_ = std::move(merged);
+        return *this;
+    }
+
+    /** Differences two sets.
+     *
+     *  Removes those members of this set that are in the @p other set. */
+    SmallSet& operator-=(const SmallSet &other) {
+        if (this == &other) {
+            clear();
+        } else {
+            retain(other, false);
+        }
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    //                                  Set-theoretic operations
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+    /** Compute the intersection of this set with another.
+     *
+     *  Returns a new set which has only those members that are common to this set and the @p other set. */
+    SmallSet operator&(const SmallSet &other) const {
+        SmallSet retval = *this;
+        retval &= other;
+        return retval;
+    }
+
+    /** Compute the union of this set with another.
+     *
+     *  Returns a new set containing the union of all members of this set and the @p other set. */
+    SmallSet operator|(const SmallSet &other) const {
+        SmallSet retval = *this;
+        retval |= other;
+        return retval;
+    }
+
+    /** Compute the difference of this set with another.
+     *
+     *  Returns a new set containing those elements of @p this set that are not members of the @p other set. */
+    SmallSet operator-(const SmallSet &other) const {
+        SmallSet retval = *this;
+        retval -= other;
+        return retval;
+    }
+
+private:
+    // Index of the first member that is not less than value, or size() if there is none.
+    size_t lowerIndex(const Value &value) const {
+        const Value *data = storage_.data();
+        const size_t n = storage_.size();
+        if (n <= N) {
+            size_t i = 0;
+            while (i < n && comparator_(data[i], value))
+                ++i;
+            return i;
+        } else {
+            return std::lower_bound(data, data + n, value, comparator_) - data;
+        }
+    }
+
+    // Keep only those members whose existence in other is equal to keepIfExists, preserving order.
+    void retain(const SmallSet &other, bool keepIfExists) {
+        Value *data = storage_.data();
+        size_t n = 0;
+        for (size_t i = 0; i < storage_.size(); ++i) {
+            if (other.exists(data[i]) == keepIfExists) {
+                if (n != i)
+                    data[n] = std::move(data[i]);
+                ++n;
+            }
+        }
+        storage_.truncate(n);
+    }
+};
+
+} // namespace
+} // namespace
+
+#endif
@@ -6,6 +6,8 @@
 
 #include <ctime>
 #include <ostream>
+#include <string>
+#include <vector>
 
 namespace Sawyer {
 
@@ -33,6 +35,16 @@ public:
      *  Returns either a time or an error description. */
     static Result<Time, std::string> parse(const std::string&);
 
+    /** Parse ISO 8601 time strings and convert them to Unix time.
+     *
+     *  This is the batch equivalent of calling @ref parse followed by @ref toUnix for each string, but it doesn't create error
+     *  messages, which makes it suitable for ingesting large numbers of time stamps.  The @p times vector is resized to match
+     *  @p strings, and each element is either the Unix time or -1 if the string could not be parsed or converted. If @p failures
+     *  is non-null, then the indexes of those strings are appended to it. Returns the number of strings successfully
+     *  converted. */
+    static size_t parseUnix(const std::vector<std::string> &strings, std::vector<time_t> &times /*out*/,
+                            std::vector<size_t> *failures = nullptr);
+
     /** Current time.
      *
      *  Returns the current time. */
@@ -185,6 +197,17 @@ public:
      *  present are output. An empty time point without a timezone will result in an empty string being returned. */
     std::string toString() const;
 
+    /** Convert a time point to ISO 8601 format in a caller-supplied buffer.
+     *
+     *  This produces the same characters as the @ref toString that returns a string, but doesn't allocate memory. At most @p
+     *  size characters including a NUL terminator are written to @p buffer. The return value is the length of the full
+     *  string, not counting the NUL terminator, so if it's greater than or equal to @p size the result was truncated. A
+     *  buffer of @ref STRING_BUFFER_SIZE characters is large enough for any time that has a four-digit year. */
+    size_t toString(char *buffer, size_t size) const;
+
+    /** Buffer size sufficient for @ref toString. */
+    static const size_t STRING_BUFFER_SIZE = 32;
+
     /** Convert the time point to a Unix system time.
      *
      *  Returns the number of seconds since "1970-01-01 00:00:00Z". Returns an error string if this time point does not have a
@@ -216,6 +239,27 @@ public:
     bool operator<(const Time&) const;
 
 private:
+    // Results for parsing, other than the error messages which need the input string.
+    enum ParseStatus {
+        PARSE_OK,
+        PARSE_INVALID,
+        PARSE_NEGATIVE_ZONE,
+        PARSE_YEAR_RANGE,
+        PARSE_MONTH_RANGE,
+        PARSE_DAY_RANGE,
+        PARSE_HOUR_RANGE,
+        PARSE_MINUTE_RANGE,
+        PARSE_SECOND_RANGE,
+        PARSE_ZONE_HOUR_RANGE,
+        PARSE_ZONE_MINUTE_RANGE
+    };
+
+    // Parse a string into the time fields. The zoneBegin is set to the start of the zone for PARSE_NEGATIVE_ZONE.
+    static ParseStatus parseFields(const char *s, size_t n, Time &t /*out*/, size_t &zoneBegin /*out*/);
+
+    // Convert to Unix time. Returns null on success, or an error message.
+    const char* unixTime(time_t &result /*out*/) const;
+
     // Normalization functions
     void normalizeSecond();
     void normalizeMinute();
@@ -0,0 +1,310 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/cmake/SawyerConfig.cmake"
+  "/root/repo/docs/examples/CMakeLists.txt"
+  "/root/repo/tests/Allocation/CMakeLists.txt"
+  "/root/repo/tests/Assert/CMakeLists.txt"
+  "/root/repo/tests/Basic/CMakeLists.txt"
+  "/root/repo/tests/BitOps/CMakeLists.txt"
+  "/root/repo/tests/CommandLine/CMakeLists.txt"
+  "/root/repo/tests/Container/CMakeLists.txt"
+  "/root/repo/tests/Markup/CMakeLists.txt"
+  "/root/repo/tests/Message/CMakeLists.txt"
+  "/root/repo/tests/Pointers/CMakeLists.txt"
+  "/root/repo/tests/ProgressBar/CMakeLists.txt"
+  "/root/repo/tests/Serialization/CMakeLists.txt"
+  "/root/repo/tests/Threads/CMakeLists.txt"
+  "/root/repo/tests/Tree/CMakeLists.txt"
+  "/root/repo/tools/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/boost_atomic-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_atomic-1.74.0/libboost_atomic-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_chrono-1.74.0/boost_chrono-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_chrono-1.74.0/boost_chrono-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_chrono-1.74.0/libboost_chrono-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_chrono-1.74.0/libboost_chrono-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/boost_filesystem-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_filesystem-1.74.0/libboost_filesystem-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/boost_iostreams-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_iostreams-1.74.0/libboost_iostreams-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_random-1.74.0/boost_random-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_random-1.74.0/boost_random-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_random-1.74.0/libboost_random-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_random-1.74.0/libboost_random-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/boost_serialization-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/boost_serialization-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/libboost_serialization-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_serialization-1.74.0/libboost_serialization-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/boost_system-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_system-1.74.0/libboost_system-variant-static.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/boost_thread-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_thread-1.74.0/libboost_thread-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "SawyerConfigVersion.cmake"
+  "cmake/SawyerConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Basic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/BitOps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Allocation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Pointers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Container/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Message/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Assert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ProgressBar/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Markup/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CommandLine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Threads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Serialization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Tree/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/sawyer.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchAddressMap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchAssertAlways.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchAssertHot.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchAssertNormal.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchBitVector.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchCallbacks.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchCommandLine.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchConnectedComponents.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchDedupBuffer.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchDistinctList.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchFrozenAddressMap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchGraph.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchGraphFingerprint.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchHashMap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchHistogram.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchIntervalMap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchMap.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchMessage.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchOptional.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchReachabilityIndex.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchSmallSet.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/commandLineEx1.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/attribute.dir/DependInfo.cmake"
+  "docs/examples/CMakeFiles/graphIso.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/basicTest1.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/basicTest2.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/geometryUnitTests.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/parseUnitTests.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/timeUnitTests.dir/DependInfo.cmake"
+  "tests/Basic/CMakeFiles/timePerf.dir/DependInfo.cmake"
+  "tests/BitOps/CMakeFiles/testBitOps.dir/DependInfo.cmake"
+  "tests/Allocation/CMakeFiles/poolPerf.dir/DependInfo.cmake"
+  "tests/Allocation/CMakeFiles/smallObjectPerf.dir/DependInfo.cmake"
+  "tests/Allocation/CMakeFiles/poolMultiThread.dir/DependInfo.cmake"
+  "tests/Pointers/CMakeFiles/ptrUnitTests.dir/DependInfo.cmake"
+  "tests/Pointers/CMakeFiles/ptrMultiThread.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/optionalUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/mapUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/hashMapUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/listUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/graphUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/graphBoost.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/intervalUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/addressMapUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/bitvecTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/distinctListUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/hashedDistinctListUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/setUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/intervalSetMapUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/lineVectorUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/indexedGraphDemo.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/graphIsomorphismTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/denseIntegerSetUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/attributeUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/traceUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/resultUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/memoryUsageUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/callbacksUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/histogramUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/smallSetUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/addressMapTlbUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/frozenAddressMapUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/dedupBufferUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/graphReachabilityIndexUnitTests.dir/DependInfo.cmake"
+  "tests/Container/CMakeFiles/graphFingerprintUnitTests.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test1.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test4.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test5.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test6.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test7.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesg_test8.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesgUnitTests.dir/DependInfo.cmake"
+  "tests/Message/CMakeFiles/mesgMultithreadTests.dir/DependInfo.cmake"
+  "tests/Assert/CMakeFiles/assert_demo1.dir/DependInfo.cmake"
+  "tests/ProgressBar/CMakeFiles/progress_demo1.dir/DependInfo.cmake"
+  "tests/Markup/CMakeFiles/markupUnitTests.dir/DependInfo.cmake"
+  "tests/Markup/CMakeFiles/markupPerf.dir/DependInfo.cmake"
+  "tests/Markup/CMakeFiles/reflowPerf.dir/DependInfo.cmake"
+  "tests/Markup/CMakeFiles/lexerPerf.dir/DependInfo.cmake"
+  "tests/CommandLine/CMakeFiles/cmdline_demo1.dir/DependInfo.cmake"
+  "tests/CommandLine/CMakeFiles/cmdline_docTest.dir/DependInfo.cmake"
+  "tests/CommandLine/CMakeFiles/cmdUnitTests.dir/DependInfo.cmake"
+  "tests/CommandLine/CMakeFiles/cmdline_grepExample.dir/DependInfo.cmake"
+  "tests/CommandLine/CMakeFiles/cmdParsePerf.dir/DependInfo.cmake"
+  "tests/Threads/CMakeFiles/threadWorkerTests.dir/DependInfo.cmake"
+  "tests/Threads/CMakeFiles/cachableDemo.dir/DependInfo.cmake"
+  "tests/Threads/CMakeFiles/workListTests.dir/DependInfo.cmake"
+  "tests/Serialization/CMakeFiles/serializationUnitTests.dir/DependInfo.cmake"
+  "tests/Serialization/CMakeFiles/binaryArchiveUnitTests.dir/DependInfo.cmake"
+  "tests/Tree/CMakeFiles/treeUnitTests.dir/DependInfo.cmake"
+  "tools/CMakeFiles/symbolFreq.dir/DependInfo.cmake"
+  "tools/CMakeFiles/searchCode.dir/DependInfo.cmake"
+  "tools/CMakeFiles/findIncludes.dir/DependInfo.cmake"
+  "tools/CMakeFiles/stringifyEnums.dir/DependInfo.cmake"
+  "tools/CMakeFiles/memoryReport.dir/DependInfo.cmake"
+  )
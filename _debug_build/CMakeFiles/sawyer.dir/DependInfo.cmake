@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Sawyer/Assert.C" "CMakeFiles/sawyer.dir/Sawyer/Assert.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Assert.C.o.d"
+  "/root/repo/Sawyer/Attribute.C" "CMakeFiles/sawyer.dir/Sawyer/Attribute.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Attribute.C.o.d"
+  "/root/repo/Sawyer/Benchmark.C" "CMakeFiles/sawyer.dir/Sawyer/Benchmark.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Benchmark.C.o.d"
+  "/root/repo/Sawyer/Clexer.C" "CMakeFiles/sawyer.dir/Sawyer/Clexer.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Clexer.C.o.d"
+  "/root/repo/Sawyer/CommandLine.C" "CMakeFiles/sawyer.dir/Sawyer/CommandLine.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/CommandLine.C.o.d"
+  "/root/repo/Sawyer/CommandLineBoost.C" "CMakeFiles/sawyer.dir/Sawyer/CommandLineBoost.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/CommandLineBoost.C.o.d"
+  "/root/repo/Sawyer/Database.C" "CMakeFiles/sawyer.dir/Sawyer/Database.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Database.C.o.d"
+  "/root/repo/Sawyer/DocumentBaseMarkup.C" "CMakeFiles/sawyer.dir/Sawyer/DocumentBaseMarkup.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/DocumentBaseMarkup.C.o.d"
+  "/root/repo/Sawyer/DocumentMarkup.C" "CMakeFiles/sawyer.dir/Sawyer/DocumentMarkup.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/DocumentMarkup.C.o.d"
+  "/root/repo/Sawyer/DocumentPodMarkup.C" "CMakeFiles/sawyer.dir/Sawyer/DocumentPodMarkup.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/DocumentPodMarkup.C.o.d"
+  "/root/repo/Sawyer/DocumentTextMarkup.C" "CMakeFiles/sawyer.dir/Sawyer/DocumentTextMarkup.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/DocumentTextMarkup.C.o.d"
+  "/root/repo/Sawyer/GraphTraversal.C" "CMakeFiles/sawyer.dir/Sawyer/GraphTraversal.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/GraphTraversal.C.o.d"
+  "/root/repo/Sawyer/LineVector.C" "CMakeFiles/sawyer.dir/Sawyer/LineVector.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/LineVector.C.o.d"
+  "/root/repo/Sawyer/Message.C" "CMakeFiles/sawyer.dir/Sawyer/Message.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Message.C.o.d"
+  "/root/repo/Sawyer/ObjectCache.C" "CMakeFiles/sawyer.dir/Sawyer/ObjectCache.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/ObjectCache.C.o.d"
+  "/root/repo/Sawyer/ProgressBar.C" "CMakeFiles/sawyer.dir/Sawyer/ProgressBar.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/ProgressBar.C.o.d"
+  "/root/repo/Sawyer/Sawyer.C" "CMakeFiles/sawyer.dir/Sawyer/Sawyer.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Sawyer.C.o.d"
+  "/root/repo/Sawyer/SmallObject.C" "CMakeFiles/sawyer.dir/Sawyer/SmallObject.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/SmallObject.C.o.d"
+  "/root/repo/Sawyer/Stopwatch.C" "CMakeFiles/sawyer.dir/Sawyer/Stopwatch.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Stopwatch.C.o.d"
+  "/root/repo/Sawyer/Synchronization.C" "CMakeFiles/sawyer.dir/Sawyer/Synchronization.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Synchronization.C.o.d"
+  "/root/repo/Sawyer/Time.C" "CMakeFiles/sawyer.dir/Sawyer/Time.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Time.C.o.d"
+  "/root/repo/Sawyer/Yaml.C" "CMakeFiles/sawyer.dir/Sawyer/Yaml.C.o" "gcc" "CMakeFiles/sawyer.dir/Sawyer/Yaml.C.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sawyer.dir/Sawyer/Assert.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Assert.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Attribute.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Attribute.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Benchmark.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Benchmark.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Clexer.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Clexer.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/CommandLine.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/CommandLine.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/CommandLineBoost.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/CommandLineBoost.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Database.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Database.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentBaseMarkup.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentBaseMarkup.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentMarkup.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentMarkup.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentPodMarkup.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentPodMarkup.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentTextMarkup.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/DocumentTextMarkup.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/GraphTraversal.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/GraphTraversal.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/LineVector.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/LineVector.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Message.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Message.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/ObjectCache.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/ObjectCache.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/ProgressBar.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/ProgressBar.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Sawyer.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Sawyer.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/SmallObject.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/SmallObject.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Stopwatch.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Stopwatch.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Synchronization.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Synchronization.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Time.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Time.C.o.d"
+  "CMakeFiles/sawyer.dir/Sawyer/Yaml.C.o"
+  "CMakeFiles/sawyer.dir/Sawyer/Yaml.C.o.d"
+  "libsawyer.pdb"
+  "libsawyer.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sawyer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
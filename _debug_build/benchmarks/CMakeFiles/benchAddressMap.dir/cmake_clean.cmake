@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchAddressMap.dir/benchAddressMap.C.o"
+  "CMakeFiles/benchAddressMap.dir/benchAddressMap.C.o.d"
+  "benchAddressMap"
+  "benchAddressMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchAddressMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchAssertAlways.dir/benchAssertAlways.C.o"
+  "CMakeFiles/benchAssertAlways.dir/benchAssertAlways.C.o.d"
+  "benchAssertAlways"
+  "benchAssertAlways.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchAssertAlways.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchAssertHot.dir/benchAssertHot.C.o"
+  "CMakeFiles/benchAssertHot.dir/benchAssertHot.C.o.d"
+  "benchAssertHot"
+  "benchAssertHot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchAssertHot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchAssertNormal.dir/benchAssertNormal.C.o"
+  "CMakeFiles/benchAssertNormal.dir/benchAssertNormal.C.o.d"
+  "benchAssertNormal"
+  "benchAssertNormal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchAssertNormal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchBitVector.dir/benchBitVector.C.o"
+  "CMakeFiles/benchBitVector.dir/benchBitVector.C.o.d"
+  "benchBitVector"
+  "benchBitVector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchBitVector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchCallbacks.dir/benchCallbacks.C.o"
+  "CMakeFiles/benchCallbacks.dir/benchCallbacks.C.o.d"
+  "benchCallbacks"
+  "benchCallbacks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchCallbacks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
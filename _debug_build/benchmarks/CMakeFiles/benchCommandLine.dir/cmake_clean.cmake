@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchCommandLine.dir/benchCommandLine.C.o"
+  "CMakeFiles/benchCommandLine.dir/benchCommandLine.C.o.d"
+  "benchCommandLine"
+  "benchCommandLine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchCommandLine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchConnectedComponents.dir/benchConnectedComponents.C.o"
+  "CMakeFiles/benchConnectedComponents.dir/benchConnectedComponents.C.o.d"
+  "benchConnectedComponents"
+  "benchConnectedComponents.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchConnectedComponents.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
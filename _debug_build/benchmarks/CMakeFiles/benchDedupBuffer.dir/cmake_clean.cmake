@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchDedupBuffer.dir/benchDedupBuffer.C.o"
+  "CMakeFiles/benchDedupBuffer.dir/benchDedupBuffer.C.o.d"
+  "benchDedupBuffer"
+  "benchDedupBuffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchDedupBuffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchDistinctList.dir/benchDistinctList.C.o"
+  "CMakeFiles/benchDistinctList.dir/benchDistinctList.C.o.d"
+  "benchDistinctList"
+  "benchDistinctList.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchDistinctList.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
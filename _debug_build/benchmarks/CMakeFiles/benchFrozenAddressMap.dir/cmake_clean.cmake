@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchFrozenAddressMap.dir/benchFrozenAddressMap.C.o"
+  "CMakeFiles/benchFrozenAddressMap.dir/benchFrozenAddressMap.C.o.d"
+  "benchFrozenAddressMap"
+  "benchFrozenAddressMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchFrozenAddressMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchGraph.dir/benchGraph.C.o"
+  "CMakeFiles/benchGraph.dir/benchGraph.C.o.d"
+  "benchGraph"
+  "benchGraph.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchGraph.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
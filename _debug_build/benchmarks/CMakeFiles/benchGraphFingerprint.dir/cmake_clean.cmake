@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchGraphFingerprint.dir/benchGraphFingerprint.C.o"
+  "CMakeFiles/benchGraphFingerprint.dir/benchGraphFingerprint.C.o.d"
+  "benchGraphFingerprint"
+  "benchGraphFingerprint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchGraphFingerprint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchHashMap.dir/benchHashMap.C.o"
+  "CMakeFiles/benchHashMap.dir/benchHashMap.C.o.d"
+  "benchHashMap"
+  "benchHashMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchHashMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
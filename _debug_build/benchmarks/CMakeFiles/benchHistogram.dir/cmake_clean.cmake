@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchHistogram.dir/benchHistogram.C.o"
+  "CMakeFiles/benchHistogram.dir/benchHistogram.C.o.d"
+  "benchHistogram"
+  "benchHistogram.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchHistogram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
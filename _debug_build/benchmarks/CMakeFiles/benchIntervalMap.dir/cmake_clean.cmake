@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchIntervalMap.dir/benchIntervalMap.C.o"
+  "CMakeFiles/benchIntervalMap.dir/benchIntervalMap.C.o.d"
+  "benchIntervalMap"
+  "benchIntervalMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchIntervalMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
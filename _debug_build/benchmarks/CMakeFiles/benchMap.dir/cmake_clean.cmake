@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchMap.dir/benchMap.C.o"
+  "CMakeFiles/benchMap.dir/benchMap.C.o.d"
+  "benchMap"
+  "benchMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchMessage.dir/benchMessage.C.o"
+  "CMakeFiles/benchMessage.dir/benchMessage.C.o.d"
+  "benchMessage"
+  "benchMessage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchMessage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchOptional.dir/benchOptional.C.o"
+  "CMakeFiles/benchOptional.dir/benchOptional.C.o.d"
+  "benchOptional"
+  "benchOptional.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchOptional.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
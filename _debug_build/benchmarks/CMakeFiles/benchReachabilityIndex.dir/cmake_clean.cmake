@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchReachabilityIndex.dir/benchReachabilityIndex.C.o"
+  "CMakeFiles/benchReachabilityIndex.dir/benchReachabilityIndex.C.o.d"
+  "benchReachabilityIndex"
+  "benchReachabilityIndex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchReachabilityIndex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
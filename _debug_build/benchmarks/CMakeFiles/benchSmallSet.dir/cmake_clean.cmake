@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchSmallSet.dir/benchSmallSet.C.o"
+  "CMakeFiles/benchSmallSet.dir/benchSmallSet.C.o.d"
+  "benchSmallSet"
+  "benchSmallSet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchSmallSet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
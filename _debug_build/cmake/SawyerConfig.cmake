@@ -0,0 +1,2 @@
+set(Sawyer_INCLUDE_DIRS /usr/local/include)
+set(Sawyer_LIBRARY /usr/local/lib/libsawyer.so)
@@ -0,0 +1,202 @@
+# Install script for directory: /root/repo
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so"
+         RPATH "/usr/local/lib")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_debug_build/libsawyer.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so"
+         OLD_RPATH "::::::::::::::"
+         NEW_RPATH "/usr/local/lib")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libsawyer.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/Sawyer" TYPE FILE FILES
+    "/root/repo/Sawyer/Access.h"
+    "/root/repo/Sawyer/AddressMap.h"
+    "/root/repo/Sawyer/AddressMapTlb.h"
+    "/root/repo/Sawyer/AddressSegment.h"
+    "/root/repo/Sawyer/AllocatingBuffer.h"
+    "/root/repo/Sawyer/Assert.h"
+    "/root/repo/Sawyer/Attribute.h"
+    "/root/repo/Sawyer/Benchmark.h"
+    "/root/repo/Sawyer/BiMap.h"
+    "/root/repo/Sawyer/BinaryArchive.h"
+    "/root/repo/Sawyer/BitFlags.h"
+    "/root/repo/Sawyer/BitOps.h"
+    "/root/repo/Sawyer/BitVector.h"
+    "/root/repo/Sawyer/BitVectorSupport.h"
+    "/root/repo/Sawyer/Buffer.h"
+    "/root/repo/Sawyer/CachableObject.h"
+    "/root/repo/Sawyer/Cached.h"
+    "/root/repo/Sawyer/Callbacks.h"
+    "/root/repo/Sawyer/Clexer.h"
+    "/root/repo/Sawyer/CommandLine.h"
+    "/root/repo/Sawyer/CommandLineBoost.h"
+    "/root/repo/Sawyer/Database.h"
+    "/root/repo/Sawyer/DatabasePostgresql.h"
+    "/root/repo/Sawyer/DatabaseSqlite.h"
+    "/root/repo/Sawyer/DedupBuffer.h"
+    "/root/repo/Sawyer/DefaultAllocator.h"
+    "/root/repo/Sawyer/DenseIntegerSet.h"
+    "/root/repo/Sawyer/DistinctList.h"
+    "/root/repo/Sawyer/DocumentBaseMarkup.h"
+    "/root/repo/Sawyer/DocumentMarkup.h"
+    "/root/repo/Sawyer/DocumentPodMarkup.h"
+    "/root/repo/Sawyer/DocumentTextMarkup.h"
+    "/root/repo/Sawyer/Exception.h"
+    "/root/repo/Sawyer/FileSystem.h"
+    "/root/repo/Sawyer/FrozenAddressMap.h"
+    "/root/repo/Sawyer/Geometry.h"
+    "/root/repo/Sawyer/Graph.h"
+    "/root/repo/Sawyer/GraphAlgorithm.h"
+    "/root/repo/Sawyer/GraphBoost.h"
+    "/root/repo/Sawyer/GraphDenseIteratorMap.h"
+    "/root/repo/Sawyer/GraphDenseIteratorSet.h"
+    "/root/repo/Sawyer/GraphFingerprint.h"
+    "/root/repo/Sawyer/GraphIteratorBiMap.h"
+    "/root/repo/Sawyer/GraphIteratorMap.h"
+    "/root/repo/Sawyer/GraphIteratorSet.h"
+    "/root/repo/Sawyer/GraphReachabilityIndex.h"
+    "/root/repo/Sawyer/GraphTraversal.h"
+    "/root/repo/Sawyer/HashMap.h"
+    "/root/repo/Sawyer/HashedDistinctList.h"
+    "/root/repo/Sawyer/Histogram.h"
+    "/root/repo/Sawyer/IndexedList.h"
+    "/root/repo/Sawyer/Interval.h"
+    "/root/repo/Sawyer/IntervalMap.h"
+    "/root/repo/Sawyer/IntervalSet.h"
+    "/root/repo/Sawyer/IntervalSetMap.h"
+    "/root/repo/Sawyer/Lexer.h"
+    "/root/repo/Sawyer/LineVector.h"
+    "/root/repo/Sawyer/Mainpage.h"
+    "/root/repo/Sawyer/Map.h"
+    "/root/repo/Sawyer/MappedBuffer.h"
+    "/root/repo/Sawyer/MemoryUsage.h"
+    "/root/repo/Sawyer/Message.h"
+    "/root/repo/Sawyer/NullBuffer.h"
+    "/root/repo/Sawyer/ObjectCache.h"
+    "/root/repo/Sawyer/Optional.h"
+    "/root/repo/Sawyer/Parse.h"
+    "/root/repo/Sawyer/PoolAllocator.h"
+    "/root/repo/Sawyer/ProgressBar.h"
+    "/root/repo/Sawyer/Result.h"
+    "/root/repo/Sawyer/Sawyer.h"
+    "/root/repo/Sawyer/Set.h"
+    "/root/repo/Sawyer/SharedObject.h"
+    "/root/repo/Sawyer/SharedPointer.h"
+    "/root/repo/Sawyer/SlidingWindow.h"
+    "/root/repo/Sawyer/SmallMap.h"
+    "/root/repo/Sawyer/SmallObject.h"
+    "/root/repo/Sawyer/SmallSet.h"
+    "/root/repo/Sawyer/Stack.h"
+    "/root/repo/Sawyer/StackAllocator.h"
+    "/root/repo/Sawyer/StaticBuffer.h"
+    "/root/repo/Sawyer/Stopwatch.h"
+    "/root/repo/Sawyer/Synchronization.h"
+    "/root/repo/Sawyer/ThreadWorkers.h"
+    "/root/repo/Sawyer/Time.h"
+    "/root/repo/Sawyer/Trace.h"
+    "/root/repo/Sawyer/Tracker.h"
+    "/root/repo/Sawyer/Tree.h"
+    "/root/repo/Sawyer/Type.h"
+    "/root/repo/Sawyer/WarningsOff.h"
+    "/root/repo/Sawyer/WarningsRestore.h"
+    "/root/repo/Sawyer/WorkList.h"
+    "/root/repo/Sawyer/Yaml.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/Sawyer" TYPE FILE FILES
+    "/root/repo/_debug_build/cmake/SawyerConfig.cmake"
+    "/root/repo/_debug_build/SawyerConfigVersion.cmake"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/benchmarks/cmake_install.cmake")
+  include("/root/repo/_debug_build/docs/examples/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Basic/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/BitOps/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Allocation/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Pointers/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Container/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Message/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Assert/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/ProgressBar/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Markup/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/CommandLine/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Threads/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Serialization/cmake_install.cmake")
+  include("/root/repo/_debug_build/tests/Tree/cmake_install.cmake")
+  include("/root/repo/_debug_build/tools/cmake_install.cmake")
+
+endif()
+
+if(CMAKE_INSTALL_COMPONENT)
+  set(CMAKE_INSTALL_MANIFEST "install_manifest_${CMAKE_INSTALL_COMPONENT}.txt")
+else()
+  set(CMAKE_INSTALL_MANIFEST "install_manifest.txt")
+endif()
+
+string(REPLACE ";" "\n" CMAKE_INSTALL_MANIFEST_CONTENT
+       "${CMAKE_INSTALL_MANIFEST_FILES}")
+file(WRITE "/root/repo/_debug_build/${CMAKE_INSTALL_MANIFEST}"
+     "${CMAKE_INSTALL_MANIFEST_CONTENT}")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attribute.dir/attribute.C.o"
+  "CMakeFiles/attribute.dir/attribute.C.o.d"
+  "attribute"
+  "attribute.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/attribute.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
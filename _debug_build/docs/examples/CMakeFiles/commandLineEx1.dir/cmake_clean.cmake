@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/commandLineEx1.dir/commandLineEx1.C.o"
+  "CMakeFiles/commandLineEx1.dir/commandLineEx1.C.o.d"
+  "commandLineEx1"
+  "commandLineEx1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/commandLineEx1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
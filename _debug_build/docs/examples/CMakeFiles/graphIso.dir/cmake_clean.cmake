@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphIso.dir/graphIso.C.o"
+  "CMakeFiles/graphIso.dir/graphIso.C.o.d"
+  "graphIso"
+  "graphIso.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphIso.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poolMultiThread.dir/poolMultiThread.C.o"
+  "CMakeFiles/poolMultiThread.dir/poolMultiThread.C.o.d"
+  "poolMultiThread"
+  "poolMultiThread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poolMultiThread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poolPerf.dir/poolPerf.C.o"
+  "CMakeFiles/poolPerf.dir/poolPerf.C.o.d"
+  "poolPerf"
+  "poolPerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poolPerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smallObjectPerf.dir/smallObjectPerf.C.o"
+  "CMakeFiles/smallObjectPerf.dir/smallObjectPerf.C.o.d"
+  "smallObjectPerf"
+  "smallObjectPerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smallObjectPerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/assert_demo1.dir/demo1.C.o"
+  "CMakeFiles/assert_demo1.dir/demo1.C.o.d"
+  "assert_demo1"
+  "assert_demo1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/assert_demo1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicTest1.dir/basicTest1.C.o"
+  "CMakeFiles/basicTest1.dir/basicTest1.C.o.d"
+  "basicTest1"
+  "basicTest1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicTest1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
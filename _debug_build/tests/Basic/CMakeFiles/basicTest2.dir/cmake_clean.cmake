@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basicTest2.dir/basicTest2.C.o"
+  "CMakeFiles/basicTest2.dir/basicTest2.C.o.d"
+  "basicTest2"
+  "basicTest2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basicTest2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
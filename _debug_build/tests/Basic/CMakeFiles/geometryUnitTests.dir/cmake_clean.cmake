@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/geometryUnitTests.dir/geometryUnitTests.C.o"
+  "CMakeFiles/geometryUnitTests.dir/geometryUnitTests.C.o.d"
+  "geometryUnitTests"
+  "geometryUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/geometryUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parseUnitTests.dir/parseUnitTests.C.o"
+  "CMakeFiles/parseUnitTests.dir/parseUnitTests.C.o.d"
+  "parseUnitTests"
+  "parseUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parseUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timePerf.dir/timePerf.C.o"
+  "CMakeFiles/timePerf.dir/timePerf.C.o.d"
+  "timePerf"
+  "timePerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timePerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
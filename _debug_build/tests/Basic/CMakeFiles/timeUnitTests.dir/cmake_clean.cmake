@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timeUnitTests.dir/timeUnitTests.C.o"
+  "CMakeFiles/timeUnitTests.dir/timeUnitTests.C.o.d"
+  "timeUnitTests"
+  "timeUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timeUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
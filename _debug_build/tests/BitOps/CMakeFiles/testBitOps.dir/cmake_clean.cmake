@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBitOps.dir/testBitOps.C.o"
+  "CMakeFiles/testBitOps.dir/testBitOps.C.o.d"
+  "testBitOps"
+  "testBitOps.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBitOps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmdParsePerf.dir/cmdParsePerf.C.o"
+  "CMakeFiles/cmdParsePerf.dir/cmdParsePerf.C.o.d"
+  "cmdParsePerf"
+  "cmdParsePerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdParsePerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
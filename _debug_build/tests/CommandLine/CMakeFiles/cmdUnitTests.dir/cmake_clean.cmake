@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmdUnitTests.dir/cmdUnitTests.C.o"
+  "CMakeFiles/cmdUnitTests.dir/cmdUnitTests.C.o.d"
+  "cmdUnitTests"
+  "cmdUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmdline_demo1.dir/demo1.C.o"
+  "CMakeFiles/cmdline_demo1.dir/demo1.C.o.d"
+  "cmdline_demo1"
+  "cmdline_demo1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdline_demo1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
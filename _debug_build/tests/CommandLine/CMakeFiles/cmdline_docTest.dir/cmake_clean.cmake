@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmdline_docTest.dir/docTest.C.o"
+  "CMakeFiles/cmdline_docTest.dir/docTest.C.o.d"
+  "cmdline_docTest"
+  "cmdline_docTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdline_docTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
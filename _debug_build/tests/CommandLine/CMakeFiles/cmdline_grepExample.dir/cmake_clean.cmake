@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmdline_grepExample.dir/grepExample.C.o"
+  "CMakeFiles/cmdline_grepExample.dir/grepExample.C.o.d"
+  "cmdline_grepExample"
+  "cmdline_grepExample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmdline_grepExample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
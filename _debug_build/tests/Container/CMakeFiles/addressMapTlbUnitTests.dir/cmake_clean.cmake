@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/addressMapTlbUnitTests.dir/addressMapTlbUnitTests.C.o"
+  "CMakeFiles/addressMapTlbUnitTests.dir/addressMapTlbUnitTests.C.o.d"
+  "addressMapTlbUnitTests"
+  "addressMapTlbUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/addressMapTlbUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/addressMapUnitTests.dir/addressMapUnitTests.C.o"
+  "CMakeFiles/addressMapUnitTests.dir/addressMapUnitTests.C.o.d"
+  "addressMapUnitTests"
+  "addressMapUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/addressMapUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
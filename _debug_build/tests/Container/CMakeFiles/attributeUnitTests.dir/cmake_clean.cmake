@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/attributeUnitTests.dir/attributeUnitTests.C.o"
+  "CMakeFiles/attributeUnitTests.dir/attributeUnitTests.C.o.d"
+  "attributeUnitTests"
+  "attributeUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/attributeUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
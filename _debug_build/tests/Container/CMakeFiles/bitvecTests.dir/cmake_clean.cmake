@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bitvecTests.dir/bitvecTests.C.o"
+  "CMakeFiles/bitvecTests.dir/bitvecTests.C.o.d"
+  "bitvecTests"
+  "bitvecTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bitvecTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
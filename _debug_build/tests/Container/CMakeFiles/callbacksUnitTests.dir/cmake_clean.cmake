@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/callbacksUnitTests.dir/callbacksUnitTests.C.o"
+  "CMakeFiles/callbacksUnitTests.dir/callbacksUnitTests.C.o.d"
+  "callbacksUnitTests"
+  "callbacksUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/callbacksUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
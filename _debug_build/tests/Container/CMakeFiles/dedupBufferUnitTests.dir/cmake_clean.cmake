@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dedupBufferUnitTests.dir/dedupBufferUnitTests.C.o"
+  "CMakeFiles/dedupBufferUnitTests.dir/dedupBufferUnitTests.C.o.d"
+  "dedupBufferUnitTests"
+  "dedupBufferUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dedupBufferUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/denseIntegerSetUnitTests.dir/denseIntegerSetUnitTests.C.o"
+  "CMakeFiles/denseIntegerSetUnitTests.dir/denseIntegerSetUnitTests.C.o.d"
+  "denseIntegerSetUnitTests"
+  "denseIntegerSetUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/denseIntegerSetUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
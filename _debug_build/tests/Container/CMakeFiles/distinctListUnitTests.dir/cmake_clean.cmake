@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/distinctListUnitTests.dir/distinctListUnitTests.C.o"
+  "CMakeFiles/distinctListUnitTests.dir/distinctListUnitTests.C.o.d"
+  "distinctListUnitTests"
+  "distinctListUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/distinctListUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
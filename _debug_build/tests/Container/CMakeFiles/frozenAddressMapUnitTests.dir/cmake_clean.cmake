@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frozenAddressMapUnitTests.dir/frozenAddressMapUnitTests.C.o"
+  "CMakeFiles/frozenAddressMapUnitTests.dir/frozenAddressMapUnitTests.C.o.d"
+  "frozenAddressMapUnitTests"
+  "frozenAddressMapUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frozenAddressMapUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphBoost.dir/graphBoost.C.o"
+  "CMakeFiles/graphBoost.dir/graphBoost.C.o.d"
+  "graphBoost"
+  "graphBoost.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphBoost.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphFingerprintUnitTests.dir/graphFingerprintUnitTests.C.o"
+  "CMakeFiles/graphFingerprintUnitTests.dir/graphFingerprintUnitTests.C.o.d"
+  "graphFingerprintUnitTests"
+  "graphFingerprintUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphFingerprintUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
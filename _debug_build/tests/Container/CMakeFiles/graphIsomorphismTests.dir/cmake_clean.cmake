@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphIsomorphismTests.dir/graphIsomorphismTests.C.o"
+  "CMakeFiles/graphIsomorphismTests.dir/graphIsomorphismTests.C.o.d"
+  "graphIsomorphismTests"
+  "graphIsomorphismTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphIsomorphismTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphReachabilityIndexUnitTests.dir/graphReachabilityIndexUnitTests.C.o"
+  "CMakeFiles/graphReachabilityIndexUnitTests.dir/graphReachabilityIndexUnitTests.C.o.d"
+  "graphReachabilityIndexUnitTests"
+  "graphReachabilityIndexUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphReachabilityIndexUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/graphUnitTests.dir/graphUnitTests.C.o"
+  "CMakeFiles/graphUnitTests.dir/graphUnitTests.C.o.d"
+  "graphUnitTests"
+  "graphUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/graphUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
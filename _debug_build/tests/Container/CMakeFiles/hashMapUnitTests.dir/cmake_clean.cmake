@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashMapUnitTests.dir/hashMapUnitTests.C.o"
+  "CMakeFiles/hashMapUnitTests.dir/hashMapUnitTests.C.o.d"
+  "hashMapUnitTests"
+  "hashMapUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashMapUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
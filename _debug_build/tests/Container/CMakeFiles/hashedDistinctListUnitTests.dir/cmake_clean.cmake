@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hashedDistinctListUnitTests.dir/hashedDistinctListUnitTests.C.o"
+  "CMakeFiles/hashedDistinctListUnitTests.dir/hashedDistinctListUnitTests.C.o.d"
+  "hashedDistinctListUnitTests"
+  "hashedDistinctListUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hashedDistinctListUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/histogramUnitTests.dir/histogramUnitTests.C.o"
+  "CMakeFiles/histogramUnitTests.dir/histogramUnitTests.C.o.d"
+  "histogramUnitTests"
+  "histogramUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/histogramUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
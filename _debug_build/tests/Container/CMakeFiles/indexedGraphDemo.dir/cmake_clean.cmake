@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/indexedGraphDemo.dir/indexedGraphDemo.C.o"
+  "CMakeFiles/indexedGraphDemo.dir/indexedGraphDemo.C.o.d"
+  "indexedGraphDemo"
+  "indexedGraphDemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/indexedGraphDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
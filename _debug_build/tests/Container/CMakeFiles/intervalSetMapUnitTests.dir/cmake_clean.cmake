@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/intervalSetMapUnitTests.dir/intervalSetMapUnitTests.C.o"
+  "CMakeFiles/intervalSetMapUnitTests.dir/intervalSetMapUnitTests.C.o.d"
+  "intervalSetMapUnitTests"
+  "intervalSetMapUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/intervalSetMapUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/intervalUnitTests.dir/intervalUnitTests.C.o"
+  "CMakeFiles/intervalUnitTests.dir/intervalUnitTests.C.o.d"
+  "intervalUnitTests"
+  "intervalUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/intervalUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
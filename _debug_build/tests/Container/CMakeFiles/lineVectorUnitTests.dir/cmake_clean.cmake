@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lineVectorUnitTests.dir/lineVectorUnitTests.C.o"
+  "CMakeFiles/lineVectorUnitTests.dir/lineVectorUnitTests.C.o.d"
+  "lineVectorUnitTests"
+  "lineVectorUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lineVectorUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
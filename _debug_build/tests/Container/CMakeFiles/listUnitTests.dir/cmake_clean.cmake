@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/listUnitTests.dir/listUnitTests.C.o"
+  "CMakeFiles/listUnitTests.dir/listUnitTests.C.o.d"
+  "listUnitTests"
+  "listUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/listUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
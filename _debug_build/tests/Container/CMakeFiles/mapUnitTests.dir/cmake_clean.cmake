@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapUnitTests.dir/mapUnitTests.C.o"
+  "CMakeFiles/mapUnitTests.dir/mapUnitTests.C.o.d"
+  "mapUnitTests"
+  "mapUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
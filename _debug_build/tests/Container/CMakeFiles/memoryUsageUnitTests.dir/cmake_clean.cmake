@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memoryUsageUnitTests.dir/memoryUsageUnitTests.C.o"
+  "CMakeFiles/memoryUsageUnitTests.dir/memoryUsageUnitTests.C.o.d"
+  "memoryUsageUnitTests"
+  "memoryUsageUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memoryUsageUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
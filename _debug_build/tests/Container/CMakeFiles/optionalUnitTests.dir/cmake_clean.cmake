@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/optionalUnitTests.dir/optionalUnitTests.C.o"
+  "CMakeFiles/optionalUnitTests.dir/optionalUnitTests.C.o.d"
+  "optionalUnitTests"
+  "optionalUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/optionalUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
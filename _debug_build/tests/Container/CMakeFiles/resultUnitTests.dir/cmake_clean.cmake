@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/resultUnitTests.dir/resultUnitTests.C.o"
+  "CMakeFiles/resultUnitTests.dir/resultUnitTests.C.o.d"
+  "resultUnitTests"
+  "resultUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/resultUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/setUnitTests.dir/setUnitTests.C.o"
+  "CMakeFiles/setUnitTests.dir/setUnitTests.C.o.d"
+  "setUnitTests"
+  "setUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/setUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
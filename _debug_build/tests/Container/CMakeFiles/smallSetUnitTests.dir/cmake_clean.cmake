@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smallSetUnitTests.dir/smallSetUnitTests.C.o"
+  "CMakeFiles/smallSetUnitTests.dir/smallSetUnitTests.C.o.d"
+  "smallSetUnitTests"
+  "smallSetUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smallSetUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traceUnitTests.dir/traceUnitTests.C.o"
+  "CMakeFiles/traceUnitTests.dir/traceUnitTests.C.o.d"
+  "traceUnitTests"
+  "traceUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traceUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
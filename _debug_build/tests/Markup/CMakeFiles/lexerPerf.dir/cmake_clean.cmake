@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lexerPerf.dir/lexerPerf.C.o"
+  "CMakeFiles/lexerPerf.dir/lexerPerf.C.o.d"
+  "lexerPerf"
+  "lexerPerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lexerPerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
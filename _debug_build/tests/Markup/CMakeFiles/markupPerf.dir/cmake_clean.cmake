@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/markupPerf.dir/markupPerf.C.o"
+  "CMakeFiles/markupPerf.dir/markupPerf.C.o.d"
+  "markupPerf"
+  "markupPerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/markupPerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/markupUnitTests.dir/markupUnitTests.C.o"
+  "CMakeFiles/markupUnitTests.dir/markupUnitTests.C.o.d"
+  "markupUnitTests"
+  "markupUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/markupUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reflowPerf.dir/reflowPerf.C.o"
+  "CMakeFiles/reflowPerf.dir/reflowPerf.C.o.d"
+  "reflowPerf"
+  "reflowPerf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflowPerf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
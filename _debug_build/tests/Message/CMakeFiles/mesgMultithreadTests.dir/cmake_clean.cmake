@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesgMultithreadTests.dir/mesgMultithreadTests.C.o"
+  "CMakeFiles/mesgMultithreadTests.dir/mesgMultithreadTests.C.o.d"
+  "mesgMultithreadTests"
+  "mesgMultithreadTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesgMultithreadTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesgUnitTests.dir/mesgUnitTests.C.o"
+  "CMakeFiles/mesgUnitTests.dir/mesgUnitTests.C.o.d"
+  "mesgUnitTests"
+  "mesgUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesgUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
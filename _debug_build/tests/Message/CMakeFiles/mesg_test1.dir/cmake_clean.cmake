@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test1.dir/test1.C.o"
+  "CMakeFiles/mesg_test1.dir/test1.C.o.d"
+  "mesg_test1"
+  "mesg_test1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test4.dir/test4.C.o"
+  "CMakeFiles/mesg_test4.dir/test4.C.o.d"
+  "mesg_test4"
+  "mesg_test4.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
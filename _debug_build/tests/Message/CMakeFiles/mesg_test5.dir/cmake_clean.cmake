@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test5.dir/test5.C.o"
+  "CMakeFiles/mesg_test5.dir/test5.C.o.d"
+  "mesg_test5"
+  "mesg_test5.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test5.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
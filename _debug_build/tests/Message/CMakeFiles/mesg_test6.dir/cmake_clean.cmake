@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test6.dir/test6.C.o"
+  "CMakeFiles/mesg_test6.dir/test6.C.o.d"
+  "mesg_test6"
+  "mesg_test6.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test6.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
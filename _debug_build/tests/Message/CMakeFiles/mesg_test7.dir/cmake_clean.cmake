@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test7.dir/test7.C.o"
+  "CMakeFiles/mesg_test7.dir/test7.C.o.d"
+  "mesg_test7"
+  "mesg_test7.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test7.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
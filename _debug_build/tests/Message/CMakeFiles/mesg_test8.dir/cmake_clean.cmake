@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mesg_test8.dir/test8.C.o"
+  "CMakeFiles/mesg_test8.dir/test8.C.o.d"
+  "mesg_test8"
+  "mesg_test8.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mesg_test8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
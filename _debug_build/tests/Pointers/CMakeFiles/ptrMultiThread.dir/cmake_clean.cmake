@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptrMultiThread.dir/ptrMultiThread.C.o"
+  "CMakeFiles/ptrMultiThread.dir/ptrMultiThread.C.o.d"
+  "ptrMultiThread"
+  "ptrMultiThread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ptrMultiThread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
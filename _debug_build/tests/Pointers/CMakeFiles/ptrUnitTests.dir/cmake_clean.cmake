@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ptrUnitTests.dir/ptrUnitTests.C.o"
+  "CMakeFiles/ptrUnitTests.dir/ptrUnitTests.C.o.d"
+  "ptrUnitTests"
+  "ptrUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ptrUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
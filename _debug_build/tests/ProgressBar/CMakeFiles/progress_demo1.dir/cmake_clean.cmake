@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/progress_demo1.dir/demo1.C.o"
+  "CMakeFiles/progress_demo1.dir/demo1.C.o.d"
+  "progress_demo1"
+  "progress_demo1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/progress_demo1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
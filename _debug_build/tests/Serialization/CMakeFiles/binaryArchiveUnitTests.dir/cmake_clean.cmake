@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/binaryArchiveUnitTests.dir/binaryArchiveUnitTests.C.o"
+  "CMakeFiles/binaryArchiveUnitTests.dir/binaryArchiveUnitTests.C.o.d"
+  "binaryArchiveUnitTests"
+  "binaryArchiveUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binaryArchiveUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/serializationUnitTests.dir/serializationUnitTests.C.o"
+  "CMakeFiles/serializationUnitTests.dir/serializationUnitTests.C.o.d"
+  "serializationUnitTests"
+  "serializationUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serializationUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cachableDemo.dir/cachableDemo.C.o"
+  "CMakeFiles/cachableDemo.dir/cachableDemo.C.o.d"
+  "cachableDemo"
+  "cachableDemo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cachableDemo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
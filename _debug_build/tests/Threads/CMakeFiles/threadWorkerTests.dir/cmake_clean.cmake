@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/threadWorkerTests.dir/threadWorkerTests.C.o"
+  "CMakeFiles/threadWorkerTests.dir/threadWorkerTests.C.o.d"
+  "threadWorkerTests"
+  "threadWorkerTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadWorkerTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/workListTests.dir/workListTests.C.o"
+  "CMakeFiles/workListTests.dir/workListTests.C.o.d"
+  "workListTests"
+  "workListTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/workListTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/treeUnitTests.dir/treeUnitTests.C.o"
+  "CMakeFiles/treeUnitTests.dir/treeUnitTests.C.o.d"
+  "treeUnitTests"
+  "treeUnitTests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/treeUnitTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/findIncludes.dir/findIncludes.C.o"
+  "CMakeFiles/findIncludes.dir/findIncludes.C.o.d"
+  "findIncludes"
+  "findIncludes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/findIncludes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
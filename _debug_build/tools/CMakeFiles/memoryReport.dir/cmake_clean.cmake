@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/memoryReport.dir/memoryReport.C.o"
+  "CMakeFiles/memoryReport.dir/memoryReport.C.o.d"
+  "memoryReport"
+  "memoryReport.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memoryReport.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
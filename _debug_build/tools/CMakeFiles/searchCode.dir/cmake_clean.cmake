@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/searchCode.dir/searchCode.C.o"
+  "CMakeFiles/searchCode.dir/searchCode.C.o.d"
+  "searchCode"
+  "searchCode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/searchCode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stringifyEnums.dir/stringifyEnums.C.o"
+  "CMakeFiles/stringifyEnums.dir/stringifyEnums.C.o.d"
+  "stringifyEnums"
+  "stringifyEnums.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stringifyEnums.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symbolFreq.dir/symbolFreq.C.o"
+  "CMakeFiles/symbolFreq.dir/symbolFreq.C.o.d"
+  "symbolFreq"
+  "symbolFreq.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symbolFreq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
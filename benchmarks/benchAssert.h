@@ -0,0 +1,101 @@
+// Benchmark body shared by benchAssertAlways, benchAssertNormal, and benchAssertHot.
+//
+// Assertion levels are chosen at compile time, so each of those programs defines SAWYER_ASSERT_LEVEL and BENCH_ASSERT_SUITE
+// before including this file. Comparing their results shows what the per-element assertions in the containers' inner loops
+// cost relative to the per-operation checks.
+
+#include <Sawyer/Benchmark.h>
+#include <Sawyer/BitVector.h>
+#include <Sawyer/IndexedList.h>
+#include <Sawyer/Map.h>
+
+#include <string>
+#include <vector>
+
+using namespace Sawyer::Container;
+using namespace Sawyer::Benchmark;
+
+static BitVector
+randomVector(size_t nBits, unsigned seed) {
+    BitVector bv(nBits);
+    for (size_t i = 0; i < nBits; ++i) {
+        seed = seed * 1103515245 + 12345;
+        bv.setValue(BitVector::BitRange(i), ((seed >> 16) & 1) != 0);
+    }
+    return bv;
+}
+
+int
+main(int argc, char *argv[]) {
+    Sawyer::initializeLibrary();
+    Suite suite(BENCH_ASSERT_SUITE);
+    suite.parseCommandLine(argc, argv, "benchmarks for the cost of container assertions");
+
+    static const size_t N = 10000;
+
+    // Word-at-a-time traversals where each word passes through the per-word assertions.
+    BitVector a = randomVector(4096, 1), b = randomVector(4096, 2);
+    suite.run("bitVectorCopyUnaligned", N, [&]() {
+        BitVector dst(4096);
+        for (size_t i = 0; i < N; ++i)
+            dst.copy(BitVector::BitRange::baseSize(i % 61, 4000), a, BitVector::BitRange::baseSize(i % 59, 4000));
+        doNotOptimize(dst.data());
+    });
+
+    suite.run("bitVectorCompare", N, [&]() {
+        int sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += a.compare(b);
+        doNotOptimize(sum);
+    });
+
+    suite.run("bitVectorMostSignificant", N, [&]() {
+        BitVector sparse(4096);
+        sparse.setValue(BitVector::BitRange(3), true);
+        size_t sum = 0;
+        for (size_t i = 0; i < N; ++i)
+            sum += sparse.mostSignificantSetBit().orElse(0);
+        doNotOptimize(sum);
+    });
+
+    suite.run("bitVectorToHex", N / 10, [&]() {
+        size_t sum = 0;
+        for (size_t i = 0; i < N / 10; ++i)
+            sum += a.toHex().size();
+        doNotOptimize(sum);
+    });
+
+    // Per-node assertions when walking and indexing a list.
+    typedef IndexedList<size_t> List;
+    List list;
+    for (size_t i = 0; i < N; ++i)
+        list.pushBack(i);
+
+    suite.run("indexedListIterate", N * 100, [&]() {
+        size_t sum = 0;
+        for (size_t pass = 0; pass < 100; ++pass) {
+            for (const List::Node &node: list.nodes())
+                sum += node.value() + node.id();
+        }
+        doNotOptimize(sum);
+    });
+
+    suite.run("indexedListLookup", N * 100, [&]() {
+        size_t sum = 0;
+        for (size_t pass = 0; pass < 100; ++pass) {
+            for (size_t i = 0; i < N; ++i)
+                sum += list.indexedValue((i * 7919) % N);
+        }
+        doNotOptimize(sum);
+    });
+
+    // Erasing map nodes through key iterators, which rechecks the lookup.
+    suite.run("mapEraseByKeyIterator", N, [&]() {
+        Map<size_t, size_t> map;
+        for (size_t i = 0; i < N; ++i)
+            map.insert(i, i);
+        while (!map.isEmpty())
+            map.eraseAt(map.keys().begin());
+        doNotOptimize(map.size());
+    });
+}